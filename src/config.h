@@ -123,6 +123,11 @@
     //  - SUPPORT_FILEFORMAT_JPG
     #define SUPPORT_CLIPBOARD_IMAGE         1
 #endif
+#ifndef SUPPORT_WORKER_THREADS
+    // Use worker threads to run parallel tasks (utils.h), used by models and text modules processing
+    // NOTE: If disabled, tasks are run on calling thread
+    #define SUPPORT_WORKER_THREADS          1
+#endif
 
 // rcore: Configuration values
 // NOTE: Below values are already defined inside [rcore.c] so there is no need to be
@@ -299,6 +304,11 @@
 #ifndef SUPPORT_FILEFORMAT_BDF
     #define SUPPORT_FILEFORMAT_BDF      0       // Disabled by default
 #endif
+#ifndef SUPPORT_TEXT_THREADING
+    // Use worker threads to rasterize font glyphs on font loading [LoadFontData()]
+    // NOTE: Processing falls back to calling thread if threads can not be created
+    #define SUPPORT_TEXT_THREADING      1
+#endif
 
 //------------------------------------------------------------------------------------
 // Module: rmodels - Configuration Flags
@@ -331,6 +341,11 @@
     // GPU skinning disabled by default, some GPUs do not support more than 8 VBOs
     #define SUPPORT_GPU_SKINNING        0
 #endif
+#ifndef SUPPORT_MODELS_THREADING
+    // Use worker threads to split costly models processing (i.e. CPU skinning of big meshes)
+    // NOTE: Processing falls back to calling thread if threads can not be created
+    #define SUPPORT_MODELS_THREADING    1
+#endif
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
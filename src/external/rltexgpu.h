@@ -52,6 +52,9 @@
 *       There is no need to do so when statically linking
 *
 *   VERSIONS HISTORY:
+*       1.3 (18-Oct-2026) Added rl_decompress_image_data() for CPU decoding of DXT1/DXT3/DXT5,
+*                         ETC1, ETC2, ETC2_EAC and ASTC 4x4/8x8 (LDR) block compressed data into RGBA 32bit
+*
 *       1.2 (18-Mar-2026) Renamed library to `rltexgpu`
 *                         Improved usage as standalone linrary
 *                         Decouple logging and memory allocation from raylib
@@ -138,6 +141,11 @@ RLGPUTEXAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsig
 
 RLGPUTEXAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
 
+// Decompress block compressed image data (first level only) into RGBA 32bit pixel data
+// NOTE: Supported formats: DXT1_RGB, DXT1_RGBA, DXT3_RGBA, DXT5_RGBA, ETC1_RGB, ETC2_RGB, ETC2_EAC_RGBA,
+// ASTC_4x4_RGBA, ASTC_8x8_RGBA (LDR profile, HDR blocks are decoded as error color)
+RLGPUTEXAPI unsigned char *rl_decompress_image_data(const void *data, int width, int height, int format);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -204,6 +212,16 @@ static int get_pixel_data_size(int width, int height, int format);
 // Get OpenGL internal formats and data type from rlGpuTexPixelFormat
 void get_gl_texture_formats(int format, unsigned int *gl_internal_format, unsigned int *gl_format, unsigned int *gl_type);
 
+// Block decoders, output a 4x4 block of RGBA 32bit pixels (row-major, 64 bytes)
+// NOTE: ASTC decoder outputs a block_width x block_height block
+static void decode_block_dxt_color(const unsigned char *block, unsigned char *pixels, int alpha_mode);
+static void decode_block_dxt3_alpha(const unsigned char *block, unsigned char *pixels);
+static void decode_block_dxt5_alpha(const unsigned char *block, unsigned char *pixels);
+static void decode_block_etc_color(const unsigned char *block, unsigned char *pixels, int etc2);
+static void decode_block_eac_alpha(const unsigned char *block, unsigned char *pixels);
+static void decode_block_astc(const unsigned char *block, unsigned char *pixels, int block_width, int block_height);
+static unsigned char clamp_byte(int value);     // Clamp integer value into [0..255] range
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -899,6 +917,85 @@ void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file
 }
 #endif
 
+// Decompress block compressed image data (first level only) into RGBA 32bit pixel data
+// NOTE: Returned data must be freed by the user (RLTEXGPU_FREE), NULL returned if format is not supported
+unsigned char *rl_decompress_image_data(const void *data, int width, int height, int format)
+{
+    unsigned char *pixels = RLTEXGPU_NULL;
+    int block_size = 0;
+    int block_width = 4;
+    int block_height = 4;
+
+    switch (format)
+    {
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_ETC2_RGB: block_size = 8; break;
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: block_size = 16; break;
+        case RLTEXGPU_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: block_size = 16; block_width = 8; block_height = 8; break;
+        default: RLTEXGPU_LOG("Decompression not supported for compressed format (%i)", format); break;
+    }
+
+    if ((data == RLTEXGPU_NULL) || (width <= 0) || (height <= 0) || (block_size == 0)) return pixels;
+
+    pixels = (unsigned char *)RLTEXGPU_MALLOC(width*height*4);
+
+    if (pixels != RLTEXGPU_NULL)
+    {
+        const unsigned char *block = (const unsigned char *)data;
+        unsigned char block_pixels[8*8*4] = { 0 };
+        int blocks_x = (width + block_width - 1)/block_width;
+        int blocks_y = (height + block_height - 1)/block_height;
+
+        for (int by = 0; by < blocks_y; by++)
+        {
+            for (int bx = 0; bx < blocks_x; bx++, block += block_size)
+            {
+                switch (format)
+                {
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT1_RGB: decode_block_dxt_color(block, block_pixels, 0); break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT1_RGBA: decode_block_dxt_color(block, block_pixels, 1); break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                    {
+                        decode_block_dxt_color(block + 8, block_pixels, 2);
+                        decode_block_dxt3_alpha(block, block_pixels);
+                    } break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                    {
+                        decode_block_dxt_color(block + 8, block_pixels, 2);
+                        decode_block_dxt5_alpha(block, block_pixels);
+                    } break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_ETC1_RGB: decode_block_etc_color(block, block_pixels, 0); break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_ETC2_RGB: decode_block_etc_color(block, block_pixels, 1); break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                    {
+                        decode_block_etc_color(block + 8, block_pixels, 1);
+                        decode_block_eac_alpha(block, block_pixels);
+                    } break;
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+                    case RLTEXGPU_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: decode_block_astc(block, block_pixels, block_width, block_height); break;
+                    default: break;
+                }
+
+                // Copy decoded block into output, clipping partial blocks on right/bottom borders
+                int copy_width = ((bx + 1)*block_width <= width)? block_width : (width - bx*block_width);
+                int copy_height = ((by + 1)*block_height <= height)? block_height : (height - by*block_height);
+
+                for (int y = 0; y < copy_height; y++)
+                {
+                    RLTEXGPU_MEMCPY(pixels + ((by*block_height + y)*width + bx*block_width)*4, block_pixels + y*block_width*4, copy_width*4);
+                }
+            }
+        }
+    }
+
+    return pixels;
+}
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -1024,6 +1121,822 @@ void get_gl_texture_formats(int format, unsigned int *gl_internal_format, unsign
     }
     */
 }
+
+// Decode DXT color block (8 bytes) into RGBA 32bit 4x4 pixels
+// NOTE: alpha_mode: 0 - DXT1 RGB, 1 - DXT1 RGBA (1 bit alpha), 2 - DXT3/DXT5 color (always 4 colors)
+static void decode_block_dxt_color(const unsigned char *block, unsigned char *pixels, int alpha_mode)
+{
+    unsigned int c0 = block[0] | (block[1] << 8);
+    unsigned int c1 = block[2] | (block[3] << 8);
+    unsigned int indices = block[4] | (block[5] << 8) | (block[6] << 16) | ((unsigned int)block[7] << 24);
+    unsigned char palette[4][4] = { 0 };
+
+    // Expand R5G6B5 endpoints to 8 bit per channel
+    palette[0][0] = (unsigned char)((((c0 >> 11) & 0x1f) << 3) | (((c0 >> 11) & 0x1f) >> 2));
+    palette[0][1] = (unsigned char)((((c0 >> 5) & 0x3f) << 2) | (((c0 >> 5) & 0x3f) >> 4));
+    palette[0][2] = (unsigned char)(((c0 & 0x1f) << 3) | ((c0 & 0x1f) >> 2));
+    palette[0][3] = 255;
+    palette[1][0] = (unsigned char)((((c1 >> 11) & 0x1f) << 3) | (((c1 >> 11) & 0x1f) >> 2));
+    palette[1][1] = (unsigned char)((((c1 >> 5) & 0x3f) << 2) | (((c1 >> 5) & 0x3f) >> 4));
+    palette[1][2] = (unsigned char)(((c1 & 0x1f) << 3) | ((c1 & 0x1f) >> 2));
+    palette[1][3] = 255;
+
+    if ((c0 > c1) || (alpha_mode == 2))
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            palette[2][i] = (unsigned char)((2*palette[0][i] + palette[1][i])/3);
+            palette[3][i] = (unsigned char)((palette[0][i] + 2*palette[1][i])/3);
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    }
+    else
+    {
+        for (int i = 0; i < 3; i++) palette[2][i] = (unsigned char)((palette[0][i] + palette[1][i])/2);
+        palette[2][3] = 255;
+
+        // Fourth color is black, transparent only if 1 bit alpha is supported
+        palette[3][3] = (alpha_mode == 1)? 0 : 255;
+    }
+
+    for (int i = 0; i < 16; i++, indices >>= 2) RLTEXGPU_MEMCPY(pixels + i*4, palette[indices & 0x3], 4);
+}
+
+// Decode DXT3 explicit alpha block (8 bytes, 4 bit per pixel) into 4x4 pixels alpha channel
+static void decode_block_dxt3_alpha(const unsigned char *block, unsigned char *pixels)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        unsigned char alpha = (block[i/2] >> ((i%2)*4)) & 0x0f;
+        pixels[i*4 + 3] = (unsigned char)(alpha*17);
+    }
+}
+
+// Decode DXT5 interpolated alpha block (8 bytes) into 4x4 pixels alpha channel
+static void decode_block_dxt5_alpha(const unsigned char *block, unsigned char *pixels)
+{
+    unsigned int a0 = block[0];
+    unsigned int a1 = block[1];
+    unsigned char palette[8] = { (unsigned char)a0, (unsigned char)a1, 0 };
+
+    if (a0 > a1) for (int i = 1; i < 7; i++) palette[i + 1] = (unsigned char)(((7 - i)*a0 + i*a1)/7);
+    else
+    {
+        for (int i = 1; i < 5; i++) palette[i + 1] = (unsigned char)(((5 - i)*a0 + i*a1)/5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    // 48 bits of 3 bit indices, little-endian
+    unsigned long long indices = 0;
+    for (int i = 0; i < 6; i++) indices |= (unsigned long long)block[2 + i] << (8*i);
+
+    for (int i = 0; i < 16; i++, indices >>= 3) pixels[i*4 + 3] = palette[indices & 0x7];
+}
+
+// Clamp integer value into [0..255] range
+static unsigned char clamp_byte(int value)
+{
+    return (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+}
+
+// Decode ETC1/ETC2 RGB color block (8 bytes) into RGBA 32bit 4x4 pixels
+// NOTE: ETC2 adds T, H and planar modes, encoded as overflowing ETC1 differential colors
+static void decode_block_etc_color(const unsigned char *block, unsigned char *pixels, int etc2)
+{
+    static const int modifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+    static const int distances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+    unsigned long long bits = 0;
+    for (int i = 0; i < 8; i++) bits = (bits << 8) | block[i];  // Big-endian block
+
+    unsigned int hi = (unsigned int)(bits >> 32);
+    unsigned int lo = (unsigned int)bits;
+    int diff = (hi >> 1) & 1;
+    int flip = hi & 1;
+
+    if (diff && etc2)
+    {
+        int r = (int)((hi >> 27) & 0x1f) + (((int)((hi >> 24) & 0x7) ^ 4) - 4);
+        int g = (int)((hi >> 19) & 0x1f) + (((int)((hi >> 16) & 0x7) ^ 4) - 4);
+        int b = (int)((hi >> 11) & 0x1f) + (((int)((hi >> 8) & 0x7) ^ 4) - 4);
+
+        if ((r < 0) || (r > 31) || (g < 0) || (g > 31))
+        {
+            // T mode and H mode: two base colors (4 bit) and four paint colors selected per pixel
+            int c[2][3] = { 0 };
+            int dist = 0;
+
+            if ((r < 0) || (r > 31))
+            {
+                c[0][0] = (((hi >> 27) & 0x3) << 2) | ((hi >> 24) & 0x3);
+                c[0][1] = (hi >> 20) & 0xf;
+                c[0][2] = (hi >> 16) & 0xf;
+                c[1][0] = (hi >> 12) & 0xf;
+                c[1][1] = (hi >> 8) & 0xf;
+                c[1][2] = (hi >> 4) & 0xf;
+                dist = distances[(((hi >> 2) & 0x3) << 1) | (hi & 1)];
+            }
+            else
+            {
+                c[0][0] = (hi >> 27) & 0xf;
+                c[0][1] = (((hi >> 24) & 0x7) << 1) | ((hi >> 20) & 1);
+                c[0][2] = (((hi >> 19) & 1) << 3) | (((hi >> 16) & 0x3) << 1) | ((hi >> 15) & 1);
+                c[1][0] = (hi >> 11) & 0xf;
+                c[1][1] = (((hi >> 8) & 0x7) << 1) | ((hi >> 7) & 1);
+                c[1][2] = (hi >> 3) & 0xf;
+            }
+
+            for (int k = 0; k < 2; k++) for (int i = 0; i < 3; i++) c[k][i] = c[k][i]*17;
+
+            unsigned char paint[4][3] = { 0 };
+
+            if ((r < 0) || (r > 31))
+            {
+                for (int i = 0; i < 3; i++)
+                {
+                    paint[0][i] = (unsigned char)c[0][i];
+                    paint[1][i] = clamp_byte(c[1][i] + dist);
+                    paint[2][i] = (unsigned char)c[1][i];
+                    paint[3][i] = clamp_byte(c[1][i] - dist);
+                }
+            }
+            else
+            {
+                int order = (((c[0][0] << 16) | (c[0][1] << 8) | c[0][2]) >= ((c[1][0] << 16) | (c[1][1] << 8) | c[1][2]))? 1 : 0;
+                dist = distances[(((hi >> 2) & 1) << 2) | ((hi & 1) << 1) | order];
+
+                for (int i = 0; i < 3; i++)
+                {
+                    paint[0][i] = clamp_byte(c[0][i] + dist);
+                    paint[1][i] = clamp_byte(c[0][i] - dist);
+                    paint[2][i] = clamp_byte(c[1][i] + dist);
+                    paint[3][i] = clamp_byte(c[1][i] - dist);
+                }
+            }
+
+            for (int x = 0; x < 4; x++)
+            {
+                for (int y = 0; y < 4; y++)
+                {
+                    int i = x*4 + y;
+                    int index = (((lo >> (16 + i)) & 1) << 1) | ((lo >> i) & 1);
+                    unsigned char *pixel = pixels + (y*4 + x)*4;
+
+                    pixel[0] = paint[index][0];
+                    pixel[1] = paint[index][1];
+                    pixel[2] = paint[index][2];
+                    pixel[3] = 255;
+                }
+            }
+
+            return;
+        }
+        else if ((b < 0) || (b > 31))
+        {
+            // Planar mode: three colors (origin, horizontal, vertical) interpolated across the block
+            int ro = (int)((bits >> 57) & 0x3f);
+            int go = (int)((((bits >> 56) & 1) << 6) | ((bits >> 49) & 0x3f));
+            int bo = (int)((((bits >> 48) & 1) << 5) | (((bits >> 43) & 0x3) << 3) | ((bits >> 39) & 0x7));
+            int rh = (int)((((bits >> 34) & 0x1f) << 1) | ((bits >> 32) & 1));
+            int gh = (int)((bits >> 25) & 0x7f);
+            int bh = (int)((bits >> 19) & 0x3f);
+            int rv = (int)((bits >> 13) & 0x3f);
+            int gv = (int)((bits >> 6) & 0x7f);
+            int bv = (int)(bits & 0x3f);
+
+            ro = (ro << 2) | (ro >> 4); rh = (rh << 2) | (rh >> 4); rv = (rv << 2) | (rv >> 4);
+            go = (go << 1) | (go >> 6); gh = (gh << 1) | (gh >> 6); gv = (gv << 1) | (gv >> 6);
+            bo = (bo << 2) | (bo >> 4); bh = (bh << 2) | (bh >> 4); bv = (bv << 2) | (bv >> 4);
+
+            for (int y = 0; y < 4; y++)
+            {
+                for (int x = 0; x < 4; x++)
+                {
+                    unsigned char *pixel = pixels + (y*4 + x)*4;
+
+                    pixel[0] = clamp_byte((x*(rh - ro) + y*(rv - ro) + 4*ro + 2) >> 2);
+                    pixel[1] = clamp_byte((x*(gh - go) + y*(gv - go) + 4*go + 2) >> 2);
+                    pixel[2] = clamp_byte((x*(bh - bo) + y*(bv - bo) + 4*bo + 2) >> 2);
+                    pixel[3] = 255;
+                }
+            }
+
+            return;
+        }
+    }
+
+    // ETC1 individual/differential modes: two sub-blocks with base color and modifier table
+    int base[2][3] = { 0 };
+
+    if (diff)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            int c = (int)((hi >> (27 - i*8)) & 0x1f);
+            int d = (((int)((hi >> (24 - i*8)) & 0x7) ^ 4) - 4);
+            int c2 = (c + d) & 0x1f;
+
+            base[0][i] = (c << 3) | (c >> 2);
+            base[1][i] = (c2 << 3) | (c2 >> 2);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            base[0][i] = (int)((hi >> (28 - i*8)) & 0xf)*17;
+            base[1][i] = (int)((hi >> (24 - i*8)) & 0xf)*17;
+        }
+    }
+
+    const int *table[2] = { modifiers[(hi >> 5) & 0x7], modifiers[(hi >> 2) & 0x7] };
+
+    for (int x = 0; x < 4; x++)
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            int i = x*4 + y;
+            int sub = flip? (y >= 2) : (x >= 2);
+            int msb = (lo >> (16 + i)) & 1;
+            int modifier = table[sub][(lo >> i) & 1];
+            if (msb) modifier = -modifier;
+
+            unsigned char *pixel = pixels + (y*4 + x)*4;
+
+            pixel[0] = clamp_byte(base[sub][0] + modifier);
+            pixel[1] = clamp_byte(base[sub][1] + modifier);
+            pixel[2] = clamp_byte(base[sub][2] + modifier);
+            pixel[3] = 255;
+        }
+    }
+}
+
+// Decode EAC alpha block (8 bytes) into 4x4 pixels alpha channel
+static void decode_block_eac_alpha(const unsigned char *block, unsigned char *pixels)
+{
+    static const int modifiers[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    int base = block[0];
+    int multiplier = block[1] >> 4;
+    const int *table = modifiers[block[1] & 0x0f];
+
+    // 48 bits of 3 bit indices, big-endian, pixels in column-major order
+    unsigned long long indices = 0;
+    for (int i = 0; i < 6; i++) indices = (indices << 8) | block[2 + i];
+
+    for (int i = 0; i < 16; i++)
+    {
+        int x = i/4;
+        int y = i%4;
+
+        pixels[(y*4 + x)*4 + 3] = clamp_byte(base + table[(indices >> (45 - 3*i)) & 0x7]*multiplier);
+    }
+}
+
+// ASTC integer sequence encoding for every quantization range (2..256 levels): trits, quints, bits
+static const unsigned char astc_ise_modes[21][3] = {
+    { 0, 0, 1 }, { 1, 0, 0 }, { 0, 0, 2 }, { 0, 1, 0 }, { 1, 0, 1 }, { 0, 0, 3 }, { 0, 1, 1 },
+    { 1, 0, 2 }, { 0, 0, 4 }, { 0, 1, 2 }, { 1, 0, 3 }, { 0, 0, 5 }, { 0, 1, 3 }, { 1, 0, 4 },
+    { 0, 0, 6 }, { 0, 1, 4 }, { 1, 0, 5 }, { 0, 0, 7 }, { 0, 1, 5 }, { 1, 0, 6 }, { 0, 0, 8 }
+};
+
+// Read bits from ASTC block (little-endian), bits over limit are read as zero
+static unsigned int astc_read_bits(const unsigned char *data, int start, int count, int limit)
+{
+    unsigned int value = 0;
+
+    for (int i = 0; (i < count) && ((start + i) < limit); i++) value |= (unsigned int)((data[(start + i) >> 3] >> ((start + i) & 7)) & 1) << i;
+
+    return value;
+}
+
+// Get number of bits required to store count values with integer sequence encoding
+static int astc_ise_bits(int count, int range)
+{
+    int bits = count*astc_ise_modes[range][2];
+
+    if (astc_ise_modes[range][0]) bits += (8*count + 4)/5;
+    else if (astc_ise_modes[range][1]) bits += (7*count + 2)/3;
+
+    return bits;
+}
+
+// Decode count values stored with integer sequence encoding (trits packed by 5, quints packed by 3)
+static void astc_decode_ise(const unsigned char *data, int start, int count, int range, int *values)
+{
+    int bits = astc_ise_modes[range][2];
+    int limit = start + astc_ise_bits(count, range);
+    int pos = start;
+
+    if (astc_ise_modes[range][0])
+    {
+        for (int i = 0; i < count; i += 5)
+        {
+            static const int trit_bits[5] = { 2, 2, 1, 2, 1 };
+            int m[5] = { 0 };
+            int t[5] = { 0 };
+            int packed = 0;
+
+            for (int j = 0, shift = 0; j < 5; shift += trit_bits[j], j++)
+            {
+                m[j] = (int)astc_read_bits(data, pos, bits, limit); pos += bits;
+                packed |= (int)astc_read_bits(data, pos, trit_bits[j], limit) << shift; pos += trit_bits[j];
+            }
+
+            int c = 0;
+
+            if (((packed >> 2) & 0x7) == 0x7)
+            {
+                c = (((packed >> 5) & 0x7) << 2) | (packed & 0x3);
+                t[4] = 2;
+                t[3] = 2;
+            }
+            else
+            {
+                c = packed & 0x1f;
+
+                if (((packed >> 5) & 0x3) == 0x3) { t[4] = 2; t[3] = (packed >> 7) & 1; }
+                else { t[4] = (packed >> 7) & 1; t[3] = (packed >> 5) & 0x3; }
+            }
+
+            if ((c & 0x3) == 0x3) { t[2] = 2; t[1] = (c >> 4) & 1; t[0] = (((c >> 3) & 1) << 1) | (((c >> 2) & 1) & ~(c >> 3) & 1); }
+            else if (((c >> 2) & 0x3) == 0x3) { t[2] = 2; t[1] = 2; t[0] = c & 0x3; }
+            else { t[2] = (c >> 4) & 1; t[1] = (c >> 2) & 0x3; t[0] = (c & 0x2) | ((c & 1) & ~(c >> 1) & 1); }
+
+            for (int j = 0; (j < 5) && ((i + j) < count); j++) values[i + j] = (t[j] << bits) | m[j];
+        }
+    }
+    else if (astc_ise_modes[range][1])
+    {
+        for (int i = 0; i < count; i += 3)
+        {
+            static const int quint_bits[3] = { 3, 2, 2 };
+            int m[3] = { 0 };
+            int q[3] = { 0 };
+            int packed = 0;
+
+            for (int j = 0, shift = 0; j < 3; shift += quint_bits[j], j++)
+            {
+                m[j] = (int)astc_read_bits(data, pos, bits, limit); pos += bits;
+                packed |= (int)astc_read_bits(data, pos, quint_bits[j], limit) << shift; pos += quint_bits[j];
+            }
+
+            if ((((packed >> 1) & 0x3) == 0x3) && (((packed >> 5) & 0x3) == 0))
+            {
+                int low = packed & 1;
+                q[2] = (low << 2) | ((((packed >> 4) & 1) & ~low) << 1) | (((packed >> 3) & 1) & ~low);
+                q[1] = 4;
+                q[0] = 4;
+            }
+            else
+            {
+                int c = 0;
+
+                if (((packed >> 1) & 0x3) == 0x3) { q[2] = 4; c = (((packed >> 3) & 0x3) << 3) | ((~(packed >> 5) & 0x3) << 1) | (packed & 1); }
+                else { q[2] = (packed >> 5) & 0x3; c = packed & 0x1f; }
+
+                if ((c & 0x7) == 0x5) { q[1] = 4; q[0] = (c >> 3) & 0x3; }
+                else { q[1] = (c >> 3) & 0x3; q[0] = c & 0x7; }
+            }
+
+            for (int j = 0; (j < 3) && ((i + j) < count); j++) values[i + j] = (q[j] << bits) | m[j];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < count; i++, pos += bits) values[i] = (int)astc_read_bits(data, pos, bits, limit);
+    }
+}
+
+// Replicate bits of value to fill target bits
+static int astc_bit_replicate(int value, int bits, int target)
+{
+    int result = 0;
+
+    for (int shift = target - bits; shift > -bits; shift -= bits) result |= (shift >= 0)? (value << shift) : (value >> -shift);
+
+    return result;
+}
+
+// Unquantize color endpoint value into [0..255] range
+static int astc_unquantize_color(int value, int range)
+{
+    int trits = astc_ise_modes[range][0];
+    int bits = astc_ise_modes[range][2];
+
+    if (!trits && !astc_ise_modes[range][1]) return astc_bit_replicate(value, bits, 8);
+
+    int d = value >> bits;
+    int a = (value & 1)? 0x1ff : 0;
+    int m = (value >> 1) & ((1 << (bits - 1)) - 1);   // Bits b, c, d, e, f of spec bit layout
+    int b = 0;
+    int c = 0;
+
+    switch (bits)
+    {
+        case 1: c = trits? 204 : 113; break;
+        case 2: b = trits? m*0x116 : m*0x10c; c = trits? 93 : 54; break;
+        case 3: b = trits? ((m << 7) | (m << 2) | m) : ((m << 7) | (m << 1) | (m >> 1)); c = trits? 44 : 26; break;
+        case 4: b = trits? ((m << 6) | m) : ((m << 6) | (m >> 1)); c = trits? 22 : 13; break;
+        case 5: b = trits? ((m << 5) | (m >> 2)) : ((m << 5) | (m >> 3)); c = trits? 11 : 6; break;
+        case 6: b = (m << 4) | (m >> 4); c = 5; break;
+        default: break;
+    }
+
+    int t = (d*c + b) ^ a;
+
+    return (a & 0x80) | (t >> 2);
+}
+
+// Unquantize weight value into [0..64] range
+static int astc_unquantize_weight(int value, int range)
+{
+    int trits = astc_ise_modes[range][0];
+    int bits = astc_ise_modes[range][2];
+    int result = 0;
+
+    if (!trits && !astc_ise_modes[range][1]) result = astc_bit_replicate(value, bits, 6);
+    else if (bits == 0)
+    {
+        static const int trit_values[3] = { 0, 32, 63 };
+        static const int quint_values[5] = { 0, 16, 32, 47, 63 };
+
+        result = trits? trit_values[value] : quint_values[value];
+    }
+    else
+    {
+        int d = value >> bits;
+        int a = (value & 1)? 0x7f : 0;
+        int m = (value >> 1) & ((1 << (bits - 1)) - 1);
+        int b = 0;
+        int c = 0;
+
+        switch (bits)
+        {
+            case 1: c = trits? 50 : 28; break;
+            case 2: b = trits? m*0x45 : m*0x42; c = trits? 23 : 13; break;
+            case 3: b = (m << 5) | m; c = 11; break;
+            default: break;
+        }
+
+        result = (a & 0x20) | (((d*c + b) ^ a) >> 2);
+    }
+
+    return (result > 32)? result + 1 : result;
+}
+
+// Select texel partition from partition seed, using the hash function defined by ASTC spec
+static int astc_select_partition(int seed, int x, int y, int partition_count, int small_block)
+{
+    if (small_block) { x <<= 1; y <<= 1; }
+
+    seed += (partition_count - 1)*1024;
+
+    unsigned int rnum = (unsigned int)seed;
+    rnum ^= rnum >> 15; rnum -= rnum << 17; rnum += rnum << 7; rnum += rnum << 4;
+    rnum ^= rnum >> 5; rnum += rnum << 16; rnum ^= rnum >> 7; rnum ^= rnum >> 3;
+    rnum ^= rnum << 6; rnum ^= rnum >> 17;
+
+    static const int seed_shifts[12] = { 0, 4, 8, 12, 16, 20, 24, 28, 18, 22, 26, 30 };
+    unsigned int seeds[12] = { 0 };
+    for (int i = 0; i < 12; i++)
+    {
+        unsigned int s = ((i == 11)? ((rnum >> 30) | (rnum << 2)) : (rnum >> seed_shifts[i])) & 0xf;
+        seeds[i] = s*s;
+    }
+
+    int sh1 = 0, sh2 = 0;
+    if (seed & 1) { sh1 = (seed & 2)? 4 : 5; sh2 = (partition_count == 3)? 6 : 5; }
+    else { sh1 = (partition_count == 3)? 6 : 5; sh2 = (seed & 2)? 4 : 5; }
+    int sh3 = (seed & 0x10)? sh1 : sh2;
+
+    for (int i = 0; i < 8; i++) seeds[i] >>= (i & 1)? sh2 : sh1;
+    for (int i = 8; i < 12; i++) seeds[i] >>= sh3;
+
+    // NOTE: Only 2D blocks are supported, z coordinate (seeds 8..11) is always 0
+    int a = (int)((seeds[0]*x + seeds[1]*y + (rnum >> 14)) & 0x3f);
+    int b = (int)((seeds[2]*x + seeds[3]*y + (rnum >> 10)) & 0x3f);
+    int c = (partition_count < 3)? 0 : (int)((seeds[4]*x + seeds[5]*y + (rnum >> 6)) & 0x3f);
+    int d = (partition_count < 4)? 0 : (int)((seeds[6]*x + seeds[7]*y + (rnum >> 2)) & 0x3f);
+
+    if ((a >= b) && (a >= c) && (a >= d)) return 0;
+    else if ((b >= c) && (b >= d)) return 1;
+    else if (c >= d) return 2;
+    else return 3;
+}
+
+// Move most significant bit of b into a, used by base+offset endpoint modes
+static void astc_bit_transfer_signed(int *a, int *b)
+{
+    *b >>= 1;
+    *b |= *a & 0x80;
+    *a >>= 1;
+    *a &= 0x3f;
+    if (*a & 0x20) *a -= 0x40;
+}
+
+// Decode LDR color endpoints for color endpoint mode, returns 0 for HDR modes
+static int astc_decode_endpoints(int cem, const int *v, int *e0, int *e1)
+{
+    int a[8] = { 0 };
+    for (int i = 0; i < ((cem >> 2) + 1)*2; i++) a[i] = v[i];
+
+    switch (cem)
+    {
+        case 0:     // Luminance, direct
+        {
+            e0[0] = e0[1] = e0[2] = a[0]; e0[3] = 255;
+            e1[0] = e1[1] = e1[2] = a[1]; e1[3] = 255;
+        } break;
+        case 1:     // Luminance, base+offset
+        {
+            int l0 = (a[0] >> 2) | (a[1] & 0xc0);
+            int l1 = l0 + (a[1] & 0x3f);
+            e0[0] = e0[1] = e0[2] = l0; e0[3] = 255;
+            e1[0] = e1[1] = e1[2] = (l1 > 255)? 255 : l1; e1[3] = 255;
+        } break;
+        case 4:     // Luminance+alpha, direct
+        {
+            e0[0] = e0[1] = e0[2] = a[0]; e0[3] = a[2];
+            e1[0] = e1[1] = e1[2] = a[1]; e1[3] = a[3];
+        } break;
+        case 5:     // Luminance+alpha, base+offset
+        {
+            astc_bit_transfer_signed(&a[1], &a[0]);
+            astc_bit_transfer_signed(&a[3], &a[2]);
+            e0[0] = e0[1] = e0[2] = a[0]; e0[3] = a[2];
+            e1[0] = e1[1] = e1[2] = a[0] + a[1]; e1[3] = a[2] + a[3];
+        } break;
+        case 6:     // RGB, base+scale
+        case 10:    // RGB, base+scale plus two alpha
+        {
+            e0[0] = (a[0]*a[3]) >> 8; e0[1] = (a[1]*a[3]) >> 8; e0[2] = (a[2]*a[3]) >> 8;
+            e1[0] = a[0]; e1[1] = a[1]; e1[2] = a[2];
+            e0[3] = (cem == 10)? a[4] : 255;
+            e1[3] = (cem == 10)? a[5] : 255;
+        } break;
+        case 8:     // RGB, direct
+        case 12:    // RGBA, direct
+        {
+            if (cem == 8) { a[6] = 255; a[7] = 255; }
+
+            if ((a[1] + a[3] + a[5]) >= (a[0] + a[2] + a[4]))
+            {
+                e0[0] = a[0]; e0[1] = a[2]; e0[2] = a[4]; e0[3] = a[6];
+                e1[0] = a[1]; e1[1] = a[3]; e1[2] = a[5]; e1[3] = a[7];
+            }
+            else
+            {
+                // Blue contraction, endpoints are swapped
+                e0[0] = (a[1] + a[5]) >> 1; e0[1] = (a[3] + a[5]) >> 1; e0[2] = a[5]; e0[3] = a[7];
+                e1[0] = (a[0] + a[4]) >> 1; e1[1] = (a[2] + a[4]) >> 1; e1[2] = a[4]; e1[3] = a[6];
+            }
+        } break;
+        case 9:     // RGB, base+offset
+        case 13:    // RGBA, base+offset
+        {
+            for (int i = 0; i < ((cem == 13)? 4 : 3); i++) astc_bit_transfer_signed(&a[i*2 + 1], &a[i*2]);
+            if (cem == 9) { a[6] = 255; a[7] = 0; }
+
+            if ((a[1] + a[3] + a[5]) >= 0)
+            {
+                e0[0] = a[0]; e0[1] = a[2]; e0[2] = a[4]; e0[3] = a[6];
+                e1[0] = a[0] + a[1]; e1[1] = a[2] + a[3]; e1[2] = a[4] + a[5]; e1[3] = a[6] + a[7];
+            }
+            else
+            {
+                // Blue contraction, endpoints are swapped
+                int r = a[0] + a[1], g = a[2] + a[3], b = a[4] + a[5];
+                e0[0] = (r + b) >> 1; e0[1] = (g + b) >> 1; e0[2] = b; e0[3] = a[6] + a[7];
+                e1[0] = (a[0] + a[4]) >> 1; e1[1] = (a[2] + a[4]) >> 1; e1[2] = a[4]; e1[3] = a[6];
+            }
+        } break;
+        default: return 0;  // HDR endpoint modes not supported (LDR profile)
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        e0[i] = clamp_byte(e0[i]);
+        e1[i] = clamp_byte(e1[i]);
+    }
+
+    return 1;
+}
+
+// Decode ASTC block (16 bytes, LDR profile) into RGBA 32bit block_width x block_height pixels
+// NOTE: Reserved encodings and HDR data are decoded as error color (magenta)
+static void decode_block_astc(const unsigned char *block, unsigned char *pixels, int block_width, int block_height)
+{
+    int texel_count = block_width*block_height;
+
+    for (int i = 0; i < texel_count; i++)
+    {
+        pixels[i*4 + 0] = 255;
+        pixels[i*4 + 1] = 0;
+        pixels[i*4 + 2] = 255;
+        pixels[i*4 + 3] = 255;
+    }
+
+    int mode = (int)astc_read_bits(block, 0, 11, 128);
+
+    // Void-extent block, constant color stored as four 16bit UNORM values
+    if ((mode & 0x1ff) == 0x1fc)
+    {
+        if (mode & 0x200) return;   // HDR void-extent
+
+        for (int i = 0; i < texel_count; i++)
+        {
+            for (int c = 0; c < 4; c++) pixels[i*4 + c] = block[8 + c*2 + 1];
+        }
+
+        return;
+    }
+
+    // Decode weights grid size, quantization range and dual plane from block mode
+    int grid_width = 0;
+    int grid_height = 0;
+    int range = 0;
+    int high = (mode >> 9) & 1;
+    int dual = (mode >> 10) & 1;
+    int a = (mode >> 5) & 0x3;
+    int b = (mode >> 7) & 0x3;
+
+    if ((mode & 0x3) != 0)
+    {
+        range = ((mode >> 4) & 1) | ((mode & 0x3) << 1);
+
+        switch ((mode >> 2) & 0x3)
+        {
+            case 0: grid_width = b + 4; grid_height = a + 2; break;
+            case 1: grid_width = b + 8; grid_height = a + 2; break;
+            case 2: grid_width = a + 2; grid_height = b + 8; break;
+            case 3:
+            {
+                if (mode & 0x100) { grid_width = (b & 1) + 2; grid_height = a + 2; }
+                else { grid_width = a + 2; grid_height = (b & 1) + 6; }
+            } break;
+            default: break;
+        }
+    }
+    else
+    {
+        range = ((mode >> 4) & 1) | (((mode >> 2) & 0x3) << 1);
+
+        switch (b)
+        {
+            case 0: grid_width = 12; grid_height = a + 2; break;
+            case 1: grid_width = a + 2; grid_height = 12; break;
+            case 2: grid_width = a + 6; grid_height = ((mode >> 9) & 0x3) + 6; high = 0; dual = 0; break;
+            case 3:
+            {
+                if (a == 0) { grid_width = 6; grid_height = 10; }
+                else if (a == 1) { grid_width = 10; grid_height = 6; }
+                else return;        // Reserved
+            } break;
+            default: break;
+        }
+    }
+
+    if (range < 2) return;          // Reserved
+
+    int weight_range = (range - 2) + (high? 6 : 0);
+    int weight_count = grid_width*grid_height*(dual + 1);
+    if ((grid_width > block_width) || (grid_height > block_height) || (weight_count > 64)) return;
+
+    int weight_bits = astc_ise_bits(weight_count, weight_range);
+    if ((weight_bits < 24) || (weight_bits > 96)) return;
+
+    // Decode partitions and color endpoint modes
+    int partition_count = (int)astc_read_bits(block, 11, 2, 128) + 1;
+    if (dual && (partition_count == 4)) return;
+
+    int below_weights = 128 - weight_bits;
+    int color_start = 17;
+    int seed = 0;
+    int cem[4] = { 0 };
+
+    if (partition_count == 1) cem[0] = (int)astc_read_bits(block, 13, 4, 128);
+    else
+    {
+        seed = (int)astc_read_bits(block, 13, 10, 128);
+        color_start = 29;
+
+        int cem_bits = (int)astc_read_bits(block, 23, 6, 128);
+
+        if ((cem_bits & 0x3) == 0)
+        {
+            for (int p = 0; p < partition_count; p++) cem[p] = cem_bits >> 2;
+        }
+        else
+        {
+            // Endpoint modes of different class, extra bits are stored below weights
+            int extra_bits = 3*partition_count - 4;
+            below_weights -= extra_bits;
+            cem_bits |= (int)astc_read_bits(block, below_weights, extra_bits, 128) << 6;
+
+            int base_class = (cem_bits & 0x3) - 1;
+
+            for (int p = 0; p < partition_count; p++)
+            {
+                cem[p] = ((base_class + ((cem_bits >> (2 + p)) & 1)) << 2) | ((cem_bits >> (2 + partition_count + 2*p)) & 0x3);
+            }
+        }
+    }
+
+    int plane_component = -1;
+    if (dual)
+    {
+        below_weights -= 2;
+        plane_component = (int)astc_read_bits(block, below_weights, 2, 128);
+    }
+
+    // Decode color endpoints, using the highest quantization range fitting available bits
+    int color_count = 0;
+    for (int p = 0; p < partition_count; p++) color_count += ((cem[p] >> 2) + 1)*2;
+    if (color_count > 18) return;
+
+    int color_range = 20;
+    while ((color_range >= 4) && (astc_ise_bits(color_count, color_range) > (below_weights - color_start))) color_range--;
+    if (color_range < 4) return;
+
+    int colors[18] = { 0 };
+    int endpoints[4][2][4] = { 0 };
+    astc_decode_ise(block, color_start, color_count, color_range, colors);
+
+    for (int i = 0; i < color_count; i++) colors[i] = astc_unquantize_color(colors[i], color_range);
+
+    for (int p = 0, offset = 0; p < partition_count; offset += ((cem[p] >> 2) + 1)*2, p++)
+    {
+        if (!astc_decode_endpoints(cem[p], colors + offset, endpoints[p][0], endpoints[p][1])) return;
+    }
+
+    // Decode weights, stored in reverse bit order from the top of the block
+    unsigned char reversed[16] = { 0 };
+    for (int i = 0; i < 16; i++)
+    {
+        unsigned char value = block[15 - i];
+        value = (unsigned char)(((value & 0xf0) >> 4) | ((value & 0x0f) << 4));
+        value = (unsigned char)(((value & 0xcc) >> 2) | ((value & 0x33) << 2));
+        reversed[i] = (unsigned char)(((value & 0xaa) >> 1) | ((value & 0x55) << 1));
+    }
+
+    int weights[64] = { 0 };
+    int plane_weights[2][64 + 16] = { 0 };   // NOTE: Padded, infill reads next row/column with zero contribution
+    astc_decode_ise(reversed, 0, weight_count, weight_range, weights);
+
+    for (int i = 0; i < weight_count; i++) plane_weights[i%(dual + 1)][i/(dual + 1)] = astc_unquantize_weight(weights[i], weight_range);
+
+    // Interpolate endpoints for every texel, infilling weights grid to block size
+    int ds = (1024 + block_width/2)/(block_width - 1);
+    int dt = (1024 + block_height/2)/(block_height - 1);
+    int small_block = (texel_count < 31);
+
+    for (int t = 0; t < block_height; t++)
+    {
+        for (int s = 0; s < block_width; s++)
+        {
+            int gs = (ds*s*(grid_width - 1) + 32) >> 6;
+            int gt = (dt*t*(grid_height - 1) + 32) >> 6;
+            int fs = gs & 0xf;
+            int ft = gt & 0xf;
+            int v0 = (gs >> 4) + (gt >> 4)*grid_width;
+            int w11 = (fs*ft + 8) >> 4;
+            int w10 = ft - w11;
+            int w01 = fs - w11;
+            int w00 = 16 - fs - ft + w11;
+            int weight[2] = { 0 };
+
+            for (int plane = 0; plane <= dual; plane++)
+            {
+                const int *w = plane_weights[plane];
+                weight[plane] = (w[v0]*w00 + w[v0 + 1]*w01 + w[v0 + grid_width]*w10 + w[v0 + grid_width + 1]*w11 + 8) >> 4;
+            }
+
+            int partition = (partition_count > 1)? astc_select_partition(seed, s, t, partition_count, small_block) : 0;
+            unsigned char *pixel = pixels + (t*block_width + s)*4;
+
+            for (int c = 0; c < 4; c++)
+            {
+                int w = (c == plane_component)? weight[1] : weight[0];
+                int c0 = endpoints[partition][0][c]*257;
+                int c1 = endpoints[partition][1][c]*257;
+
+                pixel[c] = (unsigned char)(((c0*(64 - w) + c1*w + 32) >> 6) >> 8);
+            }
+        }
+    }
+}
 #endif // RLTEXGPU_IMPLEMENTATION
 
 /*
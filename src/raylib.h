@@ -313,6 +313,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtext module
+typedef struct rGlyphIndex rGlyphIndex;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -321,8 +325,18 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphIndex *glyphIndex; // Glyphs lookup by codepoint (generated on loading, NULL: glyphs linear search)
 } Font;
 
+// TextLayout, text glyphs quads laid out once for drawing (static text)
+typedef struct TextLayout {
+    int glyphCount;         // Number of glyphs quads
+    float *vertices;        // Glyphs quads vertex position (XY - 2 components per vertex, 4 vertices per glyph), relative to text position
+    float *texcoords;       // Glyphs quads texture coordinates (UV - 2 components per vertex, 4 vertices per glyph)
+    Texture2D texture;      // Font texture atlas (not owned by layout)
+    Vector2 size;           // Text size (same as MeasureTextEx())
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -342,6 +356,12 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling around target), must not be set to 0, set to 1.0f for no scale
 } Camera2D;
 
+// BoundingBox
+typedef struct BoundingBox {
+    Vector3 min;            // Minimum vertex box-corner
+    Vector3 max;            // Maximum vertex box-corner
+} BoundingBox;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -355,6 +375,7 @@ typedef struct Mesh {
     float *tangents;        // Vertex tangents (XYZW - 4 components per vertex) (shader-location = 4)
     unsigned char *colors;  // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
     unsigned short *indices; // Vertex indices (in case vertex data comes indexed)
+    unsigned int *indices32; // Vertex indices 32bit (in case vertex data comes indexed, used instead of indices when not NULL)
 
     // Skin data for animation
     int boneCount;          // Number of bones (MAX: 256 bones)
@@ -366,6 +387,9 @@ typedef struct Mesh {
     float *animVertices;    // Animated vertex positions (after bones transformations)
     float *animNormals;     // Animated normals (after bones transformations)
 
+    // Bounds for culling
+    BoundingBox bounds;     // Vertex positions bounding box (cached on UploadMesh(), static meshes)
+
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
@@ -412,6 +436,7 @@ typedef struct ModelSkeleton {
     unsigned int boneCount; // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     ModelAnimPose bindPose; // Bones base transformation (Transform[])
+    Matrix *invBindMatrices; // Bones inverse bind pose matrices (cached on model loading)
 } ModelSkeleton;
 
 // Model, meshes, materials and animation data
@@ -430,8 +455,22 @@ typedef struct Model {
     // Runtime animation data (CPU/GPU skinning)
     ModelAnimPose currentPose; // Current animation pose (Transform[])
     Matrix *boneMatrices;   // Bones animated transformation matrices
+
+    // Levels of detail
+    int lodCount;           // Number of additional levels of detail
+    Mesh *lodMeshes;        // Levels of detail meshes array (lodCount*meshCount, meshes of same level consecutive)
+    float *lodScreenSizes;  // Levels of detail screen size, level drawn when model bounds cover less screen height ratio
+
+    // Mesh instances (meshes drawn multiple times, i.e. shared by glTF nodes)
+    int instanceCount;      // Number of mesh instances, model drawn by instances if provided
+    int *instanceMeshes;    // Instances mesh index
+    Matrix *instanceTransforms; // Instances transform (applied before model transform)
 } Model;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rmodels module
+typedef struct rAnimationClip rAnimationClip;
+
 // ModelAnimation, contains a full animation sequence
 typedef struct ModelAnimation {
     char name[32];          // Animation name
@@ -439,8 +478,18 @@ typedef struct ModelAnimation {
     unsigned int boneCount; // Number of bones (per pose)
     int keyframeCount;      // Number of animation key frames
     ModelAnimPose *keyframePoses; // Animation sequence keyframe poses [keyframe][pose]
+    rAnimationClip *clip;   // Animation compressed data (keyframePoses is NULL when compressed)
 } ModelAnimation;
 
+// AnimatedInstance, animation state of a shared model
+typedef struct AnimatedInstance {
+    Model model;            // Shared model (meshes and materials not owned by instance)
+    ModelAnimPose currentPose; // Current animation pose (Transform[])
+    Matrix *boneMatrices;   // Bones animated transformation matrices
+    float **animVertices;   // Skinned vertex positions per mesh (CPU skinning, optional)
+    float **animNormals;    // Skinned normals per mesh (CPU skinning, optional)
+} AnimatedInstance;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -455,11 +504,25 @@ typedef struct RayCollision {
     Vector3 normal;         // Surface normal of hit
 } RayCollision;
 
-// BoundingBox
-typedef struct BoundingBox {
-    Vector3 min;            // Minimum vertex box-corner
-    Vector3 max;            // Maximum vertex box-corner
-} BoundingBox;
+// Frustum, view volume planes
+typedef struct Frustum {
+    Vector4 planes[6];      // Frustum planes (left, right, bottom, top, near, far), normal pointing inside: (x, y, z), distance: w
+} Frustum;
+
+// MeshBVHNode, bounding volume hierarchy node
+typedef struct MeshBVHNode {
+    BoundingBox bounds;     // Node bounding box
+    int offset;             // Leaf node: first triangle index, inner node: second child node index (first child is next node)
+    int triangleCount;      // Leaf node: number of triangles, inner node: 0
+} MeshBVHNode;
+
+// MeshBVH, mesh triangles bounding volume hierarchy (ray collision acceleration)
+typedef struct MeshBVH {
+    int nodeCount;          // Number of nodes (flattened tree, depth-first order)
+    MeshBVHNode *nodes;     // Nodes array
+    int triangleCount;      // Number of triangles
+    float *vertices;        // Triangles vertex positions, in leaf order (XYZ - 9 components per triangle)
+} MeshBVH;
 
 // Wave, audio wave data
 typedef struct Wave {
@@ -963,6 +1026,16 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Mesh optimization flags
+// NOTE: Provided as bit-wise flags to select MeshOptimize() passes
+typedef enum {
+    MESH_OPTIMIZE_WELD          = 1,    // Weld duplicated vertices into indices, removing degenerate triangles
+    MESH_OPTIMIZE_VERTEX_CACHE  = 2,    // Reorder triangles for post-transform vertex cache (Tipsify)
+    MESH_OPTIMIZE_OVERDRAW      = 4,    // Reorder triangle clusters to reduce overdraw (implies vertex cache)
+    MESH_OPTIMIZE_VERTEX_FETCH  = 8,    // Reorder vertices by first use, removing unused vertices
+    MESH_OPTIMIZE_ALL           = 15    // All mesh optimizations
+} MeshOptimizeFlags;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args); // Logging: Redirect trace log messages
@@ -970,6 +1043,8 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, const void *data, int dataSize); // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);                  // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, const char *text); // FileIO: Save text data
+typedef bool (*ImageRowLoadCallback)(int row, void *rowData, void *userData);  // Image: Load one source row on streamed resize
+typedef bool (*ImageRowSaveCallback)(int row, const void *rowData, void *userData); // Image: Save one resized row on streamed resize
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1395,6 +1470,7 @@ RLAPI void ImageBlurGaussian(Image *image, int blurSize);
 RLAPI void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
 RLAPI void ImageResize(Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RLAPI void ImageResizeNN(Image *image, int newWidth, int newHeight);                                     // Resize image (Nearest-Neighbor scaling algorithm)
+RLAPI bool ImageResizeStream(int width, int height, int format, int newWidth, int newHeight, ImageRowLoadCallback loadRow, ImageRowSaveCallback saveRow, void *userData); // Resize image data streamed by rows (Bicubic scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
@@ -1425,6 +1501,7 @@ RLAPI void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX,
 RLAPI void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color);                          // Draw line within an image (Vector version)
 RLAPI void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color);              // Draw a line defining thickness within an image
 RLAPI void ImageDrawLineStrip(Image *dst, const Vector2 *points, int pointCount, Color color);           // Draw a lines sequence within an image
+RLAPI void ImageDrawLineAA(Image *dst, Vector2 start, Vector2 end, Color color);                         // Draw anti-aliased line within an image
 RLAPI void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);               // Draw triangle within an image
 RLAPI void ImageDrawTriangleGradient(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3); // Draw triangle with interpolated colors within an image
 RLAPI void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);          // Draw triangle outline within an image
@@ -1441,12 +1518,14 @@ RLAPI void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Col
 RLAPI void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color);                        // Draw a filled circle within an image (Vector version)
 RLAPI void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color);          // Draw circle outline within an image
 RLAPI void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color);                   // Draw circle outline within an image (Vector version)
+RLAPI void ImageDrawCircleAA(Image *dst, Vector2 center, float radius, Color color);                     // Draw anti-aliased circle within an image
 RLAPI void ImageDrawCircleGradient(Image *dst, Vector2 center, float radius, Color inner, Color outer);  // Draw a gradient-filled circle within an image
 
 RLAPI void ImageDrawImage(Image *dst, Image src, int posX, int posY, Color tint);                      // Draw an image within an image
 RLAPI void ImageDrawImageEx(Image *dst, Image src, Vector2 position, float rotation, float scale, Color tint); // Draw an image with scaling and rotation within an image
 RLAPI void ImageDrawImageRec(Image *dst, Image src, Rectangle srcRec, Vector2 position, Color tint);     // Draw a part of an image defined by a rectangle within an image
 RLAPI void ImageDrawImagePro(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint); // Draw a part of an image defined by a rectangle into destination rectangle, with scaling and rotation, within an image
+RLAPI void ImageDrawImageProFilter(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint, int filter); // Draw a part of an image defined by a rectangle into destination rectangle, with scaling, rotation and filter (TEXTURE_FILTER_POINT or TEXTURE_FILTER_BILINEAR), within an image
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 RLAPI void ImageDrawTextPro(Image *dst, Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
@@ -1506,6 +1585,9 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, const int *codepoints, int codepointCount); // Load font from file with defined codepoints and generation size, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize);                             // Load font for dynamic glyphs loading, glyphs rasterized on first use into font atlas (TTF/OTF)
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamicSize(Font font, int fontSize);                                    // Load dynamic font with other size, font face data shared with provided dynamic font
 RLAPI bool IsFontValid(Font font);                                                          // Check if font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, int *glyphCount); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1520,6 +1602,9 @@ RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontS
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple characters (codepoint)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyphs quads generated once for drawing (static text)
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout, all glyphs quads drawn at once
 
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
@@ -1605,13 +1690,18 @@ RLAPI void DrawGrid(int slices, float spacing);
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
+RLAPI Model LoadModelBinary(const char *fileName);                                          // Load model from binary model file (.rlm), any file extension (i.e. cache files)
+RLAPI bool ExportModelBinary(Model model, const ModelAnimation *animations, int animCount, const char *fileName); // Export model and animations as binary model file (.rlm), returns true on success
 RLAPI bool IsModelValid(Model model);                                                       // Check if model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI void GenModelLOD(Model *model, int lodCount, float maxError);                         // Generate model levels of detail (halving triangles per level), selected on drawing by screen size
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with custom transform
+RLAPI void DrawModelChunks(Model model, Vector3 position, float scale, Color tint);         // Draw a chunked model (i.e. terrain), level of detail selected per chunk
+RLAPI void DrawModelInstance(AnimatedInstance instance, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw an animated instance of a model with custom transform
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);          // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires with custom transform
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                   // Draw bounding box (wires)
@@ -1626,7 +1716,12 @@ RLAPI void UnloadMesh(Mesh mesh);
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
+RLAPI void SetMeshCulling(bool enabled);                                                    // Set mesh frustum culling on drawing (enabled by default)
+RLAPI int GetMeshCulledCount(void);                                                         // Get number of meshes culled since BeginDrawing()
+RLAPI MeshBVH LoadMeshBVH(Mesh mesh);                                                       // Load mesh bounding volume hierarchy (ray collision acceleration)
+RLAPI void UnloadMeshBVH(MeshBVH bvh);                                                      // Unload mesh bounding volume hierarchy
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void MeshOptimize(Mesh *mesh, int flags);                                             // Optimize mesh data for drawing (MeshOptimizeFlags)
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1642,6 +1737,9 @@ RLAPI Mesh GenMeshTorus(float radius, float size, int radSeg, int sides);
 RLAPI Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);                    // Generate trefoil knot mesh
 RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data
 RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
+RLAPI Mesh GenMeshLOD(Mesh mesh, float targetRatio, float maxError);                        // Generate simplified mesh (quadric error), error relative to mesh size
+RLAPI Model GenModelCubicmap(Image cubicmap, Vector3 cubeSize, int chunkSize);              // Generate cubes-based map model from image data, greedy meshed chunks (tiled texture)
+RLAPI Model GenModelHeightmap(Image heightmap, Vector3 size, int chunkSize, int lodCount);  // Generate heightmap terrain model from image data, indexed chunks with levels of detail
 
 // Material loading/unloading functions
 RLAPI Material *LoadMaterials(const char *fileName, int *materialCount);                    // Load materials from model file
@@ -1655,16 +1753,26 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, float frame);             // Update model animation pose (vertex buffers and bone matrices)
 RLAPI void UpdateModelAnimationEx(Model model, ModelAnimation animA, float frameA, ModelAnimation animB, float frameB, float blend); // Update model animation pose, blending two animations
+RLAPI void UpdateModelAnimationBatch(Model *models, int modelCount, ModelAnimation anim, const float *frames); // Update multiple models animation pose, models sharing skeleton
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
+RLAPI bool CompressModelAnimation(ModelAnimation *anim, float maxError);                    // Compress model animation keyframes, replaced by compressed clip data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI AnimatedInstance LoadAnimatedInstance(Model model, bool skinnedBuffers);              // Load animated instance for a shared model (optional CPU skinned vertex buffers)
+RLAPI void UnloadAnimatedInstance(AnimatedInstance instance);                               // Unload animated instance data (model is not unloaded)
+RLAPI void UpdateAnimatedInstance(AnimatedInstance instance, ModelAnimation anim, float frame); // Update animated instance pose (bone matrices and skinned vertex buffers)
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2); // Check collision between two spheres
 RLAPI bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2);                         // Check collision between two bounding boxes
 RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius);          // Check collision between box and sphere
+RLAPI Frustum GetViewFrustum(void);                                                         // Get current view frustum (from modelview and projection matrices)
+RLAPI bool CheckCollisionBoxFrustum(BoundingBox box, Frustum frustum);                      // Check collision between box and frustum (conservative)
+RLAPI bool CheckCollisionSphereFrustum(Vector3 center, float radius, Frustum frustum);      // Check collision between sphere and frustum (conservative)
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);            // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                            // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);               // Get collision info between ray and mesh
+RLAPI RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform);          // Get collision info between ray and mesh using its bounding volume hierarchy
+RLAPI void GetRayCollisionMeshBVHBatch(const Ray *rays, int rayCount, MeshBVH bvh, Matrix transform, RayCollision *collisions); // Get collision info between multiple rays and mesh using its bounding volume hierarchy
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);    // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4); // Get collision info between ray and quad
 
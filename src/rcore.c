@@ -489,6 +489,10 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if SUPPORT_MODULE_RMODELS
+extern void ResetMeshCulledCount(void); // [Module: models] Resets culled meshes counter on BeginDrawing()
+extern void UnloadMeshScratch(void);    // [Module: models] Unloads mesh generation scratch memory
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -734,6 +738,9 @@ void CloseWindow(void)
 #if SUPPORT_MODULE_RTEXT
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
+#if SUPPORT_MODULE_RMODELS
+    UnloadMeshScratch();        // WARNING: Module required: rmodels
+#endif
 
     rlglClose();                // De-init rlgl
 
@@ -876,6 +883,10 @@ void BeginDrawing(void)
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
+#if SUPPORT_MODULE_RMODELS
+    ResetMeshCulledCount();             // Reset culled meshes counter
+#endif
+
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
 }
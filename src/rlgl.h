@@ -273,6 +273,8 @@
 
 // GL equivalent data types
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
+#define RL_UNSIGNED_INT                         0x1405      // GL_UNSIGNED_INT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
 
 // GL buffer usage hint
@@ -735,6 +737,7 @@ RLAPI void rlDrawRenderBatchActive(void);               // Update and draw inter
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RLAPI void rlDrawTexturedQuads(unsigned int id, const float *vertices, const float *texcoords, int quadCount); // Draw textured 2d quads at once, current color and normal (4 vertices per quad: XY, UV)
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -753,12 +756,15 @@ RLAPI void rlDrawVertexArray(int offset, int count);    // Draw vertex array (cu
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer); // Draw vertex array elements
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances); // Draw vertex array (currently active vao) with instancing
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances); // Draw vertex array elements with instancing
+RLAPI void rlDrawVertexArrayElementsEx(int offset, int count, const void *buffer, int indexType); // Draw vertex array elements, index type: RL_UNSIGNED_SHORT or RL_UNSIGNED_INT
+RLAPI void rlDrawVertexArrayElementsInstancedEx(int offset, int count, const void *buffer, int instances, int indexType); // Draw vertex array elements with instancing, index type: RL_UNSIGNED_SHORT or RL_UNSIGNED_INT
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer); // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mipmapCount); // Load texture cubemap data
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
+RLAPI void rlResizeTexture(unsigned int id, int width, int height, int format, const void *data); // Resize texture with new data on GPU, texture id and parameters are kept
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
@@ -1689,6 +1695,111 @@ void rlSetTexture(unsigned int id)
     }
 }
 
+// Draw textured 2d quads at once, vertex data added to render batch without per-vertex calls
+// NOTE: Quads vertices order: top-left, bottom-left, bottom-right, top-right (same as rlVertex2f() quads),
+// current color and normal are used for all vertices, quads are split between batches if limit is reached
+void rlDrawTexturedQuads(unsigned int id, const float *vertices, const float *texcoords, int quadCount)
+{
+    if ((vertices == NULL) || (texcoords == NULL) || (quadCount <= 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    // Vertex arrays positions require 3 components (XYZ), converted by chunks
+    float positions[256*4*3];
+
+    if (id > 0) rlEnableTexture(id);
+
+    // NOTE: Color array is disabled, current color is used for all vertices
+    glDisableClientState(GL_COLOR_ARRAY);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    for (int q = 0; q < quadCount; q += 256)
+    {
+        int count = ((quadCount - q) < 256)? (quadCount - q) : 256;
+
+        for (int v = 0; v < count*4; v++)
+        {
+            positions[3*v] = vertices[2*(q*4 + v)];
+            positions[3*v + 1] = vertices[2*(q*4 + v) + 1];
+            positions[3*v + 2] = 0.0f;
+        }
+
+        glVertexPointer(3, GL_FLOAT, 0, positions);
+        glTexCoordPointer(2, GL_FLOAT, 0, (float *)texcoords + q*4*2);  // NOTE: Cast required, software backend binds non-const arrays
+        glDrawArrays(GL_QUADS, 0, count*4);
+    }
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    if (id > 0) rlDisableTexture();
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlSetTexture(id);
+    rlBegin(RL_QUADS);
+
+    for (int q = 0; q < quadCount;)
+    {
+        // Quads available in current buffer, render batch is drawn if full
+        int count = (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - RLGL.State.vertexCounter)/4;
+
+        if (count <= 0)
+        {
+            rlCheckRenderBatchLimit(4);
+            count = (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - RLGL.State.vertexCounter)/4;
+        }
+
+        if (count > (quadCount - q)) count = quadCount - q;
+
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        float depth = RLGL.currentBatch->currentDepth;
+
+        for (int v = q*4, i = RLGL.State.vertexCounter; v < (q + count)*4; v++, i++)
+        {
+            float x = vertices[2*v];
+            float y = vertices[2*v + 1];
+
+            // Transform provided vector if required
+            if (RLGL.State.transformRequired)
+            {
+                buffer->vertices[3*i] = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*depth + RLGL.State.transform.m12;
+                buffer->vertices[3*i + 1] = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*depth + RLGL.State.transform.m13;
+                buffer->vertices[3*i + 2] = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*depth + RLGL.State.transform.m14;
+            }
+            else
+            {
+                buffer->vertices[3*i] = x;
+                buffer->vertices[3*i + 1] = y;
+                buffer->vertices[3*i + 2] = depth;
+            }
+
+            buffer->texcoords[2*i] = texcoords[2*v];
+            buffer->texcoords[2*i + 1] = texcoords[2*v + 1];
+
+            buffer->normals[3*i] = RLGL.State.normalx;
+            buffer->normals[3*i + 1] = RLGL.State.normaly;
+            buffer->normals[3*i + 2] = RLGL.State.normalz;
+
+            buffer->colors[4*i] = RLGL.State.colorr;
+            buffer->colors[4*i + 1] = RLGL.State.colorg;
+            buffer->colors[4*i + 2] = RLGL.State.colorb;
+            buffer->colors[4*i + 3] = RLGL.State.colora;
+        }
+
+        RLGL.State.vertexCounter += count*4;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count*4;
+        q += count;
+    }
+
+    // Keep last texcoord as current, same as providing vertices one by one
+    RLGL.State.texcoordx = texcoords[quadCount*4*2 - 2];
+    RLGL.State.texcoordy = texcoords[quadCount*4*2 - 1];
+
+    rlEnd();
+    rlSetTexture(0);
+#endif
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
@@ -3292,6 +3403,12 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     unsigned char *dataPtr = NULL;
     if (data != NULL) dataPtr = (unsigned char *)data;
 
+#if defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    // Software renderer does not store mipmap levels, only base level is loaded
+    // NOTE: Loading next levels would replace base level data with smaller levels
+    mipmapCount = 1;
+#endif
+
     // Load the different mipmap levels
     for (int i = 0; i < mipmapCount; i++)
     {
@@ -3585,6 +3702,23 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
+// Resize texture with new data on GPU (single mipmap level)
+// NOTE: Texture storage is redefined for same id, parameters (filter, wrap, swizzle) are kept,
+// only uncompressed formats supported
+void rlResizeTexture(unsigned int id, int width, int height, int format, const void *data)
+{
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, glFormat, glType, data);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to resize for current texture format (%i)", id, format);
+}
+
 // Get OpenGL internal formats and data type from raylib PixelFormat
 void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
 {
@@ -4076,12 +4210,19 @@ void rlDrawVertexArray(int offset, int count)
 
 // Draw vertex array elements
 void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
+{
+    rlDrawVertexArrayElementsEx(offset, count, buffer, RL_UNSIGNED_SHORT);
+}
+
+// Draw vertex array elements, with provided index type
+// NOTE: RL_UNSIGNED_INT indices require GL_OES_element_index_uint on OpenGL ES 2.0
+void rlDrawVertexArrayElementsEx(int offset, int count, const void *buffer, int indexType)
 {
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned short *bufferPtr = (unsigned short *)buffer;
-    if (offset > 0) bufferPtr += offset;
+    unsigned char *bufferPtr = (unsigned char *)buffer;
+    if (offset > 0) bufferPtr += offset*((indexType == RL_UNSIGNED_INT)? sizeof(unsigned int) : sizeof(unsigned short));
 
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+    glDrawElements(GL_TRIANGLES, count, (indexType == RL_UNSIGNED_INT)? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, (const void *)bufferPtr);
 }
 
 // Draw vertex array instanced
@@ -4094,13 +4235,19 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 
 // Draw vertex array elements instanced
 void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+{
+    rlDrawVertexArrayElementsInstancedEx(offset, count, buffer, instances, RL_UNSIGNED_SHORT);
+}
+
+// Draw vertex array elements instanced, with provided index type
+void rlDrawVertexArrayElementsInstancedEx(int offset, int count, const void *buffer, int instances, int indexType)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned short *bufferPtr = (unsigned short *)buffer;
-    if (offset > 0) bufferPtr += offset;
+    unsigned char *bufferPtr = (unsigned char *)buffer;
+    if (offset > 0) bufferPtr += offset*((indexType == RL_UNSIGNED_INT)? sizeof(unsigned int) : sizeof(unsigned short));
 
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+    glDrawElementsInstanced(GL_TRIANGLES, count, (indexType == RL_UNSIGNED_INT)? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, (const void *)bufferPtr, instances);
 #endif
 }
 
@@ -50,11 +50,20 @@
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 #include "raymath.h"        // Required for: Vector3, Quaternion and Matrix functionality
 
+#if SUPPORT_MODELS_THREADING
+    #include "utils.h"      // Required for: RunParallelTasks()
+#endif
+
 #include <stdio.h>          // Required for: sprintf(), snprintf()
-#include <stdlib.h>         // Required for: malloc(), calloc(), free()
-#include <string.h>         // Required for: strlen(), memcmp()
+#include <stdlib.h>         // Required for: malloc(), calloc(), free(), qsort()
+#include <string.h>         // Required for: strlen(), memcmp(), memcpy(), memset()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
 
+#if (defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)) && !defined(__TINYC__)
+    #include <xmmintrin.h>  // Required for: SSE intrinsics [Used in SkinMeshVertices()]
+    #define RMODELS_SSE_ENABLED
+#endif
+
 #if SUPPORT_FILEFORMAT_OBJ || SUPPORT_FILEFORMAT_MTL
     #define TINYOBJ_MALLOC RL_MALLOC
     #define TINYOBJ_CALLOC RL_CALLOC
@@ -117,14 +126,6 @@
     #endif
 #endif
 
-#if defined(_WIN32)
-    #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
-    #define CHDIR _chdir
-#else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
-    #define CHDIR chdir
-#endif
-
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -143,16 +144,298 @@
 #ifndef MAX_FILEPATH_LENGTH
     #define MAX_FILEPATH_LENGTH   4096      // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES  4      // Maximum triangles per BVH leaf node, bigger leafs only if splitting is not worth it
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH      48      // Maximum BVH depth, also defines traversal stack size
+#endif
+#ifndef MESH_BVH_SAH_BINS
+    #define MESH_BVH_SAH_BINS       12      // Number of bins used to evaluate surface area heuristic splits
+#endif
+#ifndef MESH_BVH_RAY_PACKET_SIZE
+    #define MESH_BVH_RAY_PACKET_SIZE 16     // Number of rays traversing BVH together on batched ray collision (max: 32)
+#endif
+#ifndef MAX_MODELS_THREADS
+    #define MAX_MODELS_THREADS       4      // Maximum threads used to split models processing (calling thread included)
+#endif
+#ifndef SKINNING_THREAD_MIN_VERTICES
+    #define SKINNING_THREAD_MIN_VERTICES 8192 // Minimum mesh vertices per thread to split CPU skinning
+#endif
+#ifndef OBJ_THREAD_MIN_SIZE
+    #define OBJ_THREAD_MIN_SIZE     524288  // Minimum OBJ file text size (bytes) per thread to split parsing
+#endif
+#ifndef MESH_OPTIMIZE_CACHE_SIZE
+    #define MESH_OPTIMIZE_CACHE_SIZE    16  // Post-transform vertex cache size considered on mesh triangles reordering
+#endif
+#ifndef MESH_LOD_SEAM_ANGLE
+    #define MESH_LOD_SEAM_ANGLE      60.0f  // Minimum angle (degrees) between normals at same position kept as seam on mesh simplification
+#endif
+#ifndef MESH_LOD_BORDER_WEIGHT
+    #define MESH_LOD_BORDER_WEIGHT   10.0f  // Mesh simplification error weight of border and seam edges
+#endif
+#ifndef MESH_LOD_FLIP_ANGLE
+    #define MESH_LOD_FLIP_ANGLE      60.0f  // Maximum angle (degrees) a triangle normal can rotate on a mesh simplification collapse
+#endif
+#ifndef MESH_LOD_MAX_AREA_LOSS
+    #define MESH_LOD_MAX_AREA_LOSS   0.25f  // Maximum surface area ratio lost on mesh simplification (avoids collapsing into slivers)
+#endif
+#ifndef MESH_LOD_MAX_WEDGES
+    #define MESH_LOD_MAX_WEDGES         16  // Maximum vertices at same position (different attributes) to be simplified
+#endif
+#ifndef CUBICMAP_CHUNK_SIZE
+    #define CUBICMAP_CHUNK_SIZE         32  // Default cubicmap chunk size (cubes per side), every chunk generates a mesh
+#endif
+#ifndef HEIGHTMAP_CHUNK_SIZE
+    #define HEIGHTMAP_CHUNK_SIZE        32  // Default heightmap chunk size (cells per side), every chunk generates a mesh
+#endif
+#ifndef MODEL_LOD_SCREEN_SIZE
+    #define MODEL_LOD_SCREEN_SIZE     0.5f  // Model screen size (ratio of screen height) to draw first level of detail, halved every level
+#endif
+
+#define MODEL_FILE_VERSION           1      // Binary model file (.rlm) format version, only same version files are loaded
+#define MODEL_FILE_ALIGNMENT        16      // Binary model file data blocks alignment (bytes)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// CPU skinning task, range of mesh vertices to skin
+typedef struct SkinningTask {
+    const Mesh *meshes;         // Meshes to skin, vertices range is counted across all meshes
+    int meshCount;              // Number of meshes
+    const float *skinMatrices;  // Bones skinning matrices (28 floats per bone: position 4 columns + normal 3 columns)
+    int boneCount;              // Number of bones skinning matrices
+    int start;                  // First vertex to skin
+    int end;                    // Last vertex to skin (not included)
+    bool *updated;              // Meshes with some vertex influenced by bones (one flag per mesh, owned by task)
+} SkinningTask;
+
+// Animation clip track, bone translation, rotation or scale keys
+typedef struct AnimationTrack {
+    int keyOffset;              // First track key index in clip keys arrays
+    int keyCount;               // Number of track keys (1 for constant tracks)
+    float offset[3];            // Quantization range start (translation and scale tracks)
+    float range[3];             // Quantization range size (translation and scale tracks)
+} AnimationTrack;
+
+// Animation clip, compressed animation data
+// NOTE: Tracks are stored by bone: translation, rotation, scale
+struct rAnimationClip {
+    AnimationTrack *tracks;     // Bones tracks (boneCount*3)
+    unsigned short *keyFrames;  // Keys frame index (keyCount)
+    unsigned short *keyValues;  // Keys quantized values (keyCount*3)
+    int keyCount;               // Number of keys, all tracks
+};
+
+// Mesh triangles cluster, used on overdraw optimization
+typedef struct TriangleCluster {
+    int start;                  // First cluster triangle
+    int count;                  // Number of cluster triangles
+    float sortKey;              // Cluster outward facing metric, drawn first when higher
+} TriangleCluster;
+
+// Cubicmap cube faces, merged by face on greedy meshing
+typedef enum {
+    CUBICMAP_FACE_TOP = 0,      // Cube top face (WHITE pixels)
+    CUBICMAP_FACE_BOTTOM,       // Cube bottom face (WHITE pixels)
+    CUBICMAP_FACE_ROOF,         // Roof face (BLACK pixels)
+    CUBICMAP_FACE_FLOOR,        // Floor face (BLACK pixels)
+    CUBICMAP_FACE_FRONT,        // Cube front face (+z), next to BLACK pixel or map border
+    CUBICMAP_FACE_BACK,         // Cube back face (-z), next to BLACK pixel or map border
+    CUBICMAP_FACE_RIGHT,        // Cube right face (+x), next to BLACK pixel or map border
+    CUBICMAP_FACE_LEFT          // Cube left face (-x), next to BLACK pixel or map border
+} CubicmapFace;
+
+// Mesh simplification quadric, symmetric matrix, vector and constant terms of squared distance to planes
+typedef struct MeshQuadric {
+    float a00, a11, a22;        // Matrix diagonal
+    float a10, a20, a21;        // Matrix off-diagonal
+    float b0, b1, b2;           // Vector
+    float c;                    // Constant
+    float weight;               // Planes weight (area), error is normalized by weight
+} MeshQuadric;
+
+// Mesh simplification edge collapse, position group moved into target group
+typedef struct EdgeCollapse {
+    unsigned int group;         // Group collapsed (removed)
+    unsigned int target;        // Group target (kept)
+    float error;                // Collapse error (squared distance, relative to mesh size)
+} EdgeCollapse;
+
+// Mesh simplification state, vertices grouped by position
+typedef struct MeshSimplifier {
+    unsigned int *indices;      // Triangles vertex indices
+    int triangleCount;          // Number of triangles
+    int groupCount;             // Number of position groups
+    unsigned int *groups;       // Vertex position group
+    unsigned int *wedges;       // Group vertices (wedges), group range defined by wedgeOffset, 0xffffffff for merged ones
+    int *wedgeOffset;           // Group vertices first index (groupCount + 1)
+    Vector3 *positions;         // Group position, normalized to mesh size
+    MeshQuadric *quadrics;      // Group error quadric
+    int *triangles;             // Group triangles, group range defined by triangleOffset
+    int *triangleOffset;        // Group triangles first index (groupCount + 1)
+    unsigned int *openEdges;    // Group neighbors through open edges (border or seam), 2 per group
+    int *openCount;             // Group open neighbors count, more than 2 locks the group
+    bool *edgeOpen;             // Triangle edge is open (border or seam), edge starting at every index
+    float area;                 // Surface area (doubled), normalized to mesh size
+    float minArea;              // Surface area (doubled) to keep, collapses are not valid below it
+} MeshSimplifier;
+
+#if SUPPORT_FILEFORMAT_GLTF
+// glTF primitive to load into a model mesh
+typedef struct PrimitiveGLTF {
+    cgltf_node *node;           // Node linking the primitive (first node for shared meshes)
+    cgltf_primitive *primitive; // Primitive data
+    Matrix transform;           // Transform applied to mesh data (identity for shared meshes)
+} PrimitiveGLTF;
+
+// glTF data loading task, images decoded and primitives loaded (every step elements, starting at first)
+typedef struct LoadTaskGLTF {
+    const char *fileName;       // Model file name (logging)
+    const char *texPath;        // Images files directory path
+    cgltf_data *data;           // glTF data
+    PrimitiveGLTF *primitives;  // Primitives to load
+    Mesh *meshes;               // Meshes to fill (one per primitive)
+    int *meshMaterial;          // Meshes material index to fill
+    int meshCount;              // Number of primitives (meshes)
+    Image *images;              // Decoded images (one per glTF image)
+    bool *imageUsed;            // Images to decode (used by materials)
+    int first;                  // First element processed
+    int step;                   // Elements step (tasks count)
+} LoadTaskGLTF;
+#endif
+
+#if SUPPORT_FILEFORMAT_OBJ
+// OBJ mesh break (shape or material change), applied before chunk triangle
+typedef struct MeshBreakOBJ {
+    int triangle;               // Chunk triangle index
+    const char *material;       // Material name (usemtl), NULL for shape breaks (o, g)
+    int materialLength;         // Material name length
+} MeshBreakOBJ;
+
+// OBJ parsing task, file text chunk (whole lines) parsed into model attributes and chunk triangles
+typedef struct ParseTaskOBJ {
+    const char *text;           // Chunk text (file text pointer)
+    int length;                 // Chunk text length
+    int counts[3];              // Chunk positions, texcoords and normals count
+    int bases[3];               // Positions, texcoords and normals defined before chunk
+    float *positions;           // Model positions (3 floats per position)
+    float *texcoords;           // Model texcoords (2 floats per texcoord)
+    float *normals;             // Model normals (3 floats per normal)
+    tinyobj_vertex_index_t *corners; // Chunk triangles corners, model attributes indices (3 per triangle)
+    int triangleCount;          // Chunk triangles count
+    int triangleBase;           // Triangles defined before chunk
+    MeshBreakOBJ *breaks;       // Chunk mesh breaks
+    int breakCount;             // Chunk mesh breaks count
+    const char *mtllib;         // Materials library file name (last mtllib in chunk)
+    int mtllibLength;           // Materials library file name length
+} ParseTaskOBJ;
+
+// OBJ meshes filling task, model triangles range copied into meshes
+typedef struct FillTaskOBJ {
+    const ParseTaskOBJ *chunks; // Parsed chunks
+    Mesh *meshes;               // Meshes to fill
+    const int *meshTriangles;   // Meshes first model triangle (meshCount + 1 entries)
+    int counts[3];              // Model positions, texcoords and normals count
+    int first;                  // First model triangle filled
+    int last;                   // Last model triangle filled (not included)
+} FillTaskOBJ;
+#endif
+
+// Binary model file (.rlm) mesh attributes, data blocks order
+typedef enum {
+    MODEL_FILE_VERTICES = 0,    // Vertex positions (3 floats per vertex)
+    MODEL_FILE_TEXCOORDS,       // Texture coordinates (2 floats per vertex)
+    MODEL_FILE_TEXCOORDS2,      // Texture second coordinates (2 floats per vertex)
+    MODEL_FILE_NORMALS,         // Normals (3 floats per vertex)
+    MODEL_FILE_TANGENTS,        // Tangents (4 floats per vertex)
+    MODEL_FILE_COLORS,          // Colors (4 bytes per vertex)
+    MODEL_FILE_INDICES,         // Indices 16bit (3 per triangle)
+    MODEL_FILE_INDICES32,       // Indices 32bit (3 per triangle)
+    MODEL_FILE_BONE_INDICES,    // Bone indices (4 bytes per vertex)
+    MODEL_FILE_BONE_WEIGHTS,    // Bone weights (4 floats per vertex)
+    MODEL_FILE_ATTRIBUTE_COUNT
+} ModelFileAttribute;
+
+// Binary model file (.rlm) header
+// NOTE: All data is little-endian, data blocks are aligned (MODEL_FILE_ALIGNMENT) and referenced by offset
+// from file start (0: not available), so file data could be used in place (memory-mapped)
+typedef struct ModelFileHeader {
+    char id[4];                 // File identifier: "rLMF"
+    unsigned int version;       // File format version (MODEL_FILE_VERSION)
+    unsigned int fileSize;      // File size (bytes)
+    int meshCount;              // Number of meshes
+    int materialCount;          // Number of materials
+    int textureCount;           // Number of textures (referenced by materials)
+    int boneCount;              // Number of skeleton bones
+    int lodCount;               // Number of additional levels of detail
+    int instanceCount;          // Number of mesh instances
+    int animCount;              // Number of animations
+    unsigned int meshes;        // Meshes records offset, levels of detail meshes after model meshes (ModelFileMesh)
+    unsigned int materials;     // Materials records offset (ModelFileMaterial)
+    unsigned int textures;      // Textures records offset (ModelFileTexture)
+    unsigned int bones;         // Skeleton bones offset (BoneInfo)
+    unsigned int bindPose;      // Skeleton bind pose offset (Transform)
+    unsigned int invBindMatrices; // Skeleton inverse bind matrices offset (Matrix)
+    unsigned int lodScreenSizes; // Levels of detail screen sizes offset (float)
+    unsigned int instanceMeshes; // Instances mesh index offset (int)
+    unsigned int instanceTransforms; // Instances transform offset (Matrix)
+    unsigned int animations;    // Animations records offset (ModelFileAnimation)
+} ModelFileHeader;
+
+// Binary model file (.rlm) mesh record
+typedef struct ModelFileMesh {
+    int vertexCount;            // Number of vertices
+    int triangleCount;          // Number of triangles
+    int boneCount;              // Number of bones
+    int material;               // Mesh material index (model meshes)
+    unsigned int attributes[MODEL_FILE_ATTRIBUTE_COUNT]; // Attributes data offsets (ModelFileAttribute)
+} ModelFileMesh;
+
+// Binary model file (.rlm) material record
+typedef struct ModelFileMaterial {
+    float params[4];            // Material generic parameters
+    int textures[MAX_MATERIAL_MAPS]; // Maps texture index (-1: no texture, -2: default texture)
+    Color colors[MAX_MATERIAL_MAPS]; // Maps color
+    float values[MAX_MATERIAL_MAPS]; // Maps value
+} ModelFileMaterial;
+
+// Binary model file (.rlm) texture record, first mipmap level pixel data
+typedef struct ModelFileTexture {
+    int width;                  // Texture width
+    int height;                 // Texture height
+    int mipmaps;                // Texture mipmap levels, generated on loading
+    int format;                 // Pixel data format (PixelFormat)
+    unsigned int data;          // Pixel data offset
+} ModelFileTexture;
+
+// Binary model file (.rlm) animation record
+typedef struct ModelFileAnimation {
+    char name[32];              // Animation name
+    int boneCount;              // Number of bones (per pose)
+    int keyframeCount;          // Number of keyframes
+    int keyCount;               // Number of compressed clip keys (0: not compressed)
+    unsigned int keyframePoses; // Keyframe poses offset, not compressed (Transform, keyframeCount*boneCount)
+    unsigned int tracks;        // Clip tracks offset, compressed (AnimationTrack, boneCount*3)
+    unsigned int keyFrames;     // Clip keys frame offset, compressed (unsigned short, keyCount)
+    unsigned int keyValues;     // Clip keys values offset, compressed (unsigned short, keyCount*3)
+} ModelFileAnimation;
+
+// Binary model file data buffer, data blocks appended aligned
+typedef struct ModelFileBuffer {
+    unsigned char *data;        // File data
+    unsigned int size;          // File data size
+    size_t capacity;            // File data allocated size
+} ModelFileBuffer;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static bool meshCulling = true;         // Mesh frustum culling on drawing
+static int meshCulledCount = 0;         // Meshes culled since BeginDrawing()
+
+static unsigned char *meshScratch = NULL; // Mesh generation scratch memory, reused between calls
+static size_t meshScratchSize = 0;      // Mesh generation scratch memory size
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -176,11 +459,72 @@ static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
 #if SUPPORT_FILEFORMAT_OBJ || SUPPORT_FILEFORMAT_MTL
-static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static void GetFilePathOBJ(char *path, const char *directory, const char *name, int length); // Get OBJ referenced file path, relative to directory
+static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *texPath);  // Process obj materials
 #endif
 
 // Update model vertex data (positions and normals)
 static void UpdateModelAnimationVertexBuffers(Model model);
+static void UpdateModelAnimationPose(Model model, ModelAnimation anim, float frame); // Update model current pose, interpolated animation frame
+static void UpdateModelBoneMatrices(Model model);   // Update model bone matrices from current pose
+static Transform GetAnimationBonePose(ModelAnimation anim, int boneIndex, int currentFrame, int nextFrame, float blend); // Get animation bone pose interpolated between two frames
+static Vector4 GetAnimationTrackValue(const rAnimationClip *clip, int trackIndex, float frame); // Get animation clip track value at fractional frame
+static Vector4 GetAnimationTrackKey(const rAnimationClip *clip, const AnimationTrack *track, int key, bool rotation); // Get animation clip track key value, dequantized
+static void EncodeQuaternion(Quaternion q, unsigned short *result); // Encode quaternion into 48 bits (smallest three)
+static Quaternion DecodeQuaternion(const unsigned short *value); // Decode quaternion from 48 bits (smallest three)
+static void AddAnimationTrackKey(rAnimationClip *clip, AnimationTrack *track, int frame, const unsigned short *value); // Add animation clip track key
+static bool IsAnimationSegmentValid(const Vector4 *values, const Vector4 *decoded, int start, int end, bool rotation, float maxError, bool constant); // Check track frames interpolated from keys are within error
+static Matrix GetTransformMatrix(Transform transform); // Get transform matrix: scale, rotation and translation
+static float *LoadSkinningMatrices(const Matrix *boneMatrices, int boneCount); // Load bones skinning matrices for CPU skinning
+static void SkinMeshes(const Mesh *meshes, int meshCount, const float *skinMatrices, int boneCount, bool *updated); // Skin meshes vertices into meshes animated buffers, CPU skinning
+static void SkinMeshVertices(void *data);       // Skin meshes vertices range (SkinningTask), CPU skinning
+
+static int BuildMeshBVHNode(MeshBVH *bvh, int *triangles, const float *triBounds, int start, int count, int depth); // Build BVH node for triangles range, returns node index
+static float GetRayBoxDistance(Vector3 origin, Vector3 invDirection, BoundingBox box, float maxDistance); // Get ray entry distance to box, -1.0f if no hit closer than max distance
+static Ray GetRayObjectSpace(Ray ray, Matrix invTransform);  // Get ray transformed into object space (direction not normalized)
+static void GetRayCollisionWorldSpace(RayCollision *collision, Ray ray, Matrix invTransform, float detSign); // Get collision point and normal back in world space
+static Frustum GetMatrixFrustum(Matrix matrix);  // Get frustum planes from clip space matrix (not normalized)
+static unsigned int *LoadMeshIndices(Mesh mesh); // Load mesh triangles indices as 32bit, generated for non-indexed meshes
+static int WeldMeshVertices(Mesh mesh, unsigned int *remap); // Weld vertices with same attributes, returns unique vertex count
+static void RemapMeshVertices(Mesh *mesh, const unsigned int *remap, int remapCount); // Remap mesh vertex attributes into new vertex order
+static void *RemapVertexAttribute(void *data, int size, const unsigned int *remap, int vertexCount, int remapCount); // Remap vertex attribute data, input data is freed
+static int OptimizeVertexCache(unsigned int *indices, int triangleCount, int vertexCount, int *clusters); // Reorder triangles for vertex cache (Tipsify), returns clusters count
+static void OptimizeOverdraw(unsigned int *indices, const float *vertices, const int *clusters, int clusterCount); // Reorder triangle clusters to reduce overdraw
+static int CompareTriangleClusters(const void *a, const void *b); // Compare triangle clusters sort key, used on overdraw optimization
+static void SetMeshIndices(Mesh *mesh, unsigned int *indices, int triangleCount); // Set mesh indices from 32bit indices (16bit when possible), indices are owned by mesh or freed
+static void *LoadVertexAttributeCopy(const void *data, int size, int vertexCount); // Load vertex attribute data copy
+#if SUPPORT_MESH_GENERATION
+static bool IsVertexAttributeEqual(const void *data, int size, unsigned int a, unsigned int b); // Check vertex attribute equal for two vertices (or not available)
+static int SimplifyMesh(Mesh *mesh, unsigned int *indices, int triangleCount, int targetCount, float maxError); // Simplify mesh triangles by edge collapses, returns triangles count
+static void UpdateMeshSimplifier(MeshSimplifier *simplifier, bool edgeQuadrics); // Update mesh simplifier adjacency and open edges from current triangles
+static float GetCollapseError(const MeshSimplifier *simplifier, unsigned int group, unsigned int target, unsigned int *remap, int *collapsed, float *lostArea); // Get edge collapse error, -1.0f if not valid
+static void AddQuadricPlane(MeshQuadric *quadric, Vector3 normal, float distance, float weight); // Add plane to quadric, weighted
+static MeshQuadric AddQuadrics(MeshQuadric q1, MeshQuadric q2); // Add two quadrics
+static float GetQuadricError(MeshQuadric quadric, Vector3 position); // Get quadric error at position (weighted squared distance to planes)
+static int CompareEdgeCollapses(const void *a, const void *b); // Compare edge collapses error, used on mesh simplification
+#endif
+static int GetModelLOD(Model model, int meshIndex); // Get model level of detail to draw, considering current transform and projection
+static bool IsMeshBoundsCached(Mesh mesh);     // Check if mesh bounds are cached (not all zero)
+static bool IsMeshVisible(Mesh mesh, Material material, Matrix transform); // Check if mesh is visible on drawing (mesh culling)
+static BoundingBox GetBoundingBoxTransformed(BoundingBox box, Matrix transform); // Get bounding box containing transformed box
+static bool IsModelFileValid(const unsigned char *fileData, int dataSize); // Check binary model file header (identifier, version, size)
+static void GetModelFileAttributes(Mesh *mesh, void **attributes[MODEL_FILE_ATTRIBUTE_COUNT], int sizes[MODEL_FILE_ATTRIBUTE_COUNT]); // Get mesh attributes data and element sizes (binary model file order)
+static unsigned int AddModelFileBlock(ModelFileBuffer *buffer, const void *data, size_t size); // Add binary model file data block (aligned), returns block offset
+static bool IsModelFileBlockValid(unsigned int fileSize, unsigned int offset, int count, size_t elementSize); // Check binary model file data block is within file
+static bool IsModelFileIndicesValid(const unsigned char *fileData, unsigned int offset, int count, int elementSize, unsigned int maxValue); // Check binary model file indices block values are below max value
+static void *LoadModelFileBlock(const unsigned char *fileData, unsigned int offset, int count, size_t elementSize); // Load binary model file data block copy
+static ModelAnimation *LoadModelAnimationsBinary(const char *fileName, int *animCount); // Load binary model file animations
+
+#if SUPPORT_MESH_GENERATION
+static void *LoadMeshScratch(size_t size);      // Load mesh generation scratch memory, grown if required
+static bool IsCubicmapFaceVisible(const Color *pixels, int width, int height, int x, int z, int face); // Check cubicmap cube face visible (CubicmapFace)
+static int GetMaskRectangles(bool *mask, int width, int height, bool mergeX, bool mergeY, Rectangle *rects); // Get mask rectangles (greedy), mask is cleared
+static void AddCubicmapQuad(Mesh *mesh, int face, Rectangle rec, Vector3 cubeSize); // Add cubicmap face quad covering cubes rectangle to mesh
+static Mesh GenMeshHeightmapChunk(const float *heights, const Vector3 *normals, int mapX, int mapZ, Vector3 scale, Rectangle chunk, int step); // Generate heightmap chunk mesh, grid step and skirts
+#endif
+
+extern void ResetMeshCulledCount(void);         // Reset culled meshes counter, called on BeginDrawing()
+extern void UnloadMeshScratch(void);            // Unload mesh generation scratch memory, called on CloseWindow()
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1114,6 +1458,9 @@ Model LoadModel(const char *fileName)
 {
     Model model = { 0 };
 
+    // Binary model files are loaded ready to use
+    if (IsFileExtension(fileName, ".rlm")) return LoadModelBinary(fileName);
+
 #if SUPPORT_FILEFORMAT_OBJ
     if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
 #endif
@@ -1133,6 +1480,17 @@ Model LoadModel(const char *fileName)
     // Make sure model transform is set to identity matrix!
     model.transform = MatrixIdentity();
 
+    // Cache skeleton inverse bind matrices, bind pose does not change on animation
+    if ((model.skeleton.boneCount > 0) && (model.skeleton.bindPose != NULL))
+    {
+        model.skeleton.invBindMatrices = (Matrix *)RL_MALLOC(model.skeleton.boneCount*sizeof(Matrix));
+
+        for (unsigned int i = 0; i < model.skeleton.boneCount; i++)
+        {
+            model.skeleton.invBindMatrices[i] = MatrixInvert(GetTransformMatrix(model.skeleton.bindPose[i]));
+        }
+    }
+
     if ((model.meshCount != 0) && (model.meshes != NULL))
     {
         // Upload vertex data to GPU (static meshes)
@@ -1178,6 +1536,365 @@ Model LoadModelFromMesh(Mesh mesh)
     return model;
 }
 
+// Load model from binary model file (.rlm), file extension is not checked (i.e. cache files)
+// NOTE: Data blocks are validated and copied into model arrays, no processing required,
+// meshes are uploaded to GPU and textures loaded from embedded pixel data
+Model LoadModelBinary(const char *fileName)
+{
+    Model model = { 0 };
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData == NULL) return model;
+
+    // Validate header and data blocks before loading anything
+    bool valid = IsModelFileValid(fileData, dataSize);
+    const ModelFileHeader *header = (const ModelFileHeader *)fileData;
+    unsigned int fileSize = valid? header->fileSize : 0;
+    int meshCount = 0;
+
+    if (valid)
+    {
+        valid = (header->lodCount >= 0) &&
+                IsModelFileBlockValid(fileSize, header->meshes, header->meshCount, ((size_t)header->lodCount + 1)*sizeof(ModelFileMesh)) &&
+                IsModelFileBlockValid(fileSize, header->materials, header->materialCount, sizeof(ModelFileMaterial)) &&
+                IsModelFileBlockValid(fileSize, header->textures, header->textureCount, sizeof(ModelFileTexture)) &&
+                IsModelFileBlockValid(fileSize, header->bones, header->boneCount, sizeof(BoneInfo)) &&
+                IsModelFileBlockValid(fileSize, header->bindPose, header->boneCount, sizeof(Transform)) &&
+                ((header->invBindMatrices == 0) || IsModelFileBlockValid(fileSize, header->invBindMatrices, header->boneCount, sizeof(Matrix))) &&
+                IsModelFileBlockValid(fileSize, header->lodScreenSizes, header->lodCount, sizeof(float)) &&
+                IsModelFileBlockValid(fileSize, header->instanceMeshes, header->instanceCount, sizeof(int)) &&
+                IsModelFileBlockValid(fileSize, header->instanceTransforms, header->instanceCount, sizeof(Matrix));
+    }
+
+    if (valid) meshCount = header->meshCount*(header->lodCount + 1);
+
+    for (int i = 0; valid && (i < meshCount); i++)
+    {
+        ModelFileMesh record = ((const ModelFileMesh *)(fileData + header->meshes))[i];
+        Mesh mesh = { 0 };
+        void **attributes[MODEL_FILE_ATTRIBUTE_COUNT] = { 0 };
+        int sizes[MODEL_FILE_ATTRIBUTE_COUNT] = { 0 };
+        GetModelFileAttributes(&mesh, attributes, sizes);
+
+        valid = (record.vertexCount >= 0) && (record.triangleCount >= 0) && (record.attributes[MODEL_FILE_VERTICES] != 0);
+
+        // Non-indexed meshes draw vertices as triangles, there must be enough vertices
+        if (valid && (record.attributes[MODEL_FILE_INDICES] == 0) && (record.attributes[MODEL_FILE_INDICES32] == 0)) valid = (record.triangleCount <= record.vertexCount/3);
+
+        for (int k = 0; valid && (k < MODEL_FILE_ATTRIBUTE_COUNT); k++)
+        {
+            int count = ((k == MODEL_FILE_INDICES) || (k == MODEL_FILE_INDICES32))? record.triangleCount : record.vertexCount;
+            if (record.attributes[k] != 0) valid = IsModelFileBlockValid(fileSize, record.attributes[k], count, sizes[k]);
+        }
+
+        // Indices must reference mesh vertices and bone indices skeleton bones (only used for skinning if available)
+        if (valid) valid = IsModelFileIndicesValid(fileData, record.attributes[MODEL_FILE_INDICES], record.triangleCount*3, sizeof(unsigned short), record.vertexCount) &&
+                           IsModelFileIndicesValid(fileData, record.attributes[MODEL_FILE_INDICES32], record.triangleCount*3, sizeof(unsigned int), record.vertexCount) &&
+                           ((header->boneCount <= 0) || IsModelFileIndicesValid(fileData, record.attributes[MODEL_FILE_BONE_INDICES], record.vertexCount*4, 1, header->boneCount));
+    }
+
+    for (int i = 0; valid && (i < header->instanceCount); i++)
+    {
+        int instanceMesh = ((const int *)(fileData + header->instanceMeshes))[i];
+        valid = (instanceMesh >= 0) && (instanceMesh < header->meshCount);
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Binary model file not valid", fileName);
+        UnloadFileData(fileData);
+        return model;
+    }
+
+    model.transform = MatrixIdentity();
+
+    // Load meshes, levels of detail meshes and instances
+    const ModelFileMesh *meshes = (const ModelFileMesh *)(fileData + header->meshes);
+
+    model.meshCount = header->meshCount;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    if ((header->lodCount > 0) && (model.meshCount > 0))
+    {
+        model.lodCount = header->lodCount;
+        model.lodMeshes = (Mesh *)RL_CALLOC(model.lodCount*model.meshCount, sizeof(Mesh));
+        model.lodScreenSizes = (float *)LoadModelFileBlock(fileData, header->lodScreenSizes, model.lodCount, sizeof(float));
+    }
+
+    for (int i = 0; i < meshCount; i++)
+    {
+        Mesh *mesh = (i < model.meshCount)? &model.meshes[i] : &model.lodMeshes[i - model.meshCount];
+        void **attributes[MODEL_FILE_ATTRIBUTE_COUNT] = { 0 };
+        int sizes[MODEL_FILE_ATTRIBUTE_COUNT] = { 0 };
+        GetModelFileAttributes(mesh, attributes, sizes);
+
+        mesh->vertexCount = meshes[i].vertexCount;
+        mesh->triangleCount = meshes[i].triangleCount;
+        mesh->boneCount = meshes[i].boneCount;
+
+        for (int k = 0; k < MODEL_FILE_ATTRIBUTE_COUNT; k++)
+        {
+            int count = ((k == MODEL_FILE_INDICES) || (k == MODEL_FILE_INDICES32))? mesh->triangleCount : mesh->vertexCount;
+            *attributes[k] = LoadModelFileBlock(fileData, meshes[i].attributes[k], count, sizes[k]);
+        }
+
+#if !SUPPORT_GPU_SKINNING
+        // Animated vertex data (CPU skinning)
+        if ((header->boneCount > 0) && (mesh->boneWeights != NULL))
+        {
+            mesh->animVertices = (float *)LoadVertexAttributeCopy(mesh->vertices, 3*sizeof(float), mesh->vertexCount);
+            mesh->animNormals = (float *)RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+            if (mesh->normals != NULL) memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+        }
+#endif
+        UploadMesh(mesh, false);
+
+        if ((i < model.meshCount) && (meshes[i].material >= 0) && (meshes[i].material < header->materialCount)) model.meshMaterial[i] = meshes[i].material;
+    }
+
+    if (header->instanceCount > 0)
+    {
+        model.instanceCount = header->instanceCount;
+        model.instanceMeshes = (int *)LoadModelFileBlock(fileData, header->instanceMeshes, model.instanceCount, sizeof(int));
+        model.instanceTransforms = (Matrix *)LoadModelFileBlock(fileData, header->instanceTransforms, model.instanceCount, sizeof(Matrix));
+    }
+
+    // Load textures from embedded pixel data and materials
+    const ModelFileTexture *textureRecords = (const ModelFileTexture *)(fileData + header->textures);
+    Texture2D *textures = (Texture2D *)RL_CALLOC((header->textureCount > 0)? header->textureCount : 1, sizeof(Texture2D));
+
+    for (int t = 0; t < header->textureCount; t++)
+    {
+        ModelFileTexture record = textureRecords[t];
+
+        // NOTE: Only uncompressed pixel formats are exported
+        if ((record.width > 0) && (record.height > 0) && (record.format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (record.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+            IsModelFileBlockValid(fileSize, record.data, record.height, (size_t)record.width*GetPixelDataSize(1, 1, record.format)))
+        {
+            Image image = { fileData + record.data, record.width, record.height, 1, record.format };
+
+            textures[t] = LoadTextureFromImage(image);
+            if (record.mipmaps > 1) GenTextureMipmaps(&textures[t]);
+        }
+    }
+
+    const ModelFileMaterial *materials = (const ModelFileMaterial *)(fileData + header->materials);
+
+    model.materialCount = header->materialCount;
+    model.materials = (Material *)RL_CALLOC((model.materialCount > 0)? model.materialCount : 1, sizeof(Material));
+
+    for (int i = 0; i < model.materialCount; i++)
+    {
+        model.materials[i] = LoadMaterialDefault();
+        for (int k = 0; k < 4; k++) model.materials[i].params[k] = materials[i].params[k];
+
+        for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+        {
+            int texture = materials[i].textures[m];
+
+            if (texture == -2) model.materials[i].maps[m].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            else if ((texture >= 0) && (texture < header->textureCount)) model.materials[i].maps[m].texture = textures[texture];
+            else model.materials[i].maps[m].texture = (Texture2D){ 0 };
+
+            model.materials[i].maps[m].color = materials[i].colors[m];
+            model.materials[i].maps[m].value = materials[i].values[m];
+        }
+    }
+
+    if (model.materialCount == 0)
+    {
+        model.materialCount = 1;
+        model.materials[0] = LoadMaterialDefault();
+    }
+
+    RL_FREE(textures);
+
+    // Load skeleton and initialize runtime animation data
+    if (header->boneCount > 0)
+    {
+        model.skeleton.boneCount = header->boneCount;
+        model.skeleton.bones = (BoneInfo *)LoadModelFileBlock(fileData, header->bones, header->boneCount, sizeof(BoneInfo));
+        model.skeleton.bindPose = (Transform *)LoadModelFileBlock(fileData, header->bindPose, header->boneCount, sizeof(Transform));
+        model.skeleton.invBindMatrices = (Matrix *)LoadModelFileBlock(fileData, header->invBindMatrices, header->boneCount, sizeof(Matrix));
+
+        if (model.skeleton.invBindMatrices == NULL)
+        {
+            model.skeleton.invBindMatrices = (Matrix *)RL_MALLOC(model.skeleton.boneCount*sizeof(Matrix));
+            for (unsigned int i = 0; i < model.skeleton.boneCount; i++) model.skeleton.invBindMatrices[i] = MatrixInvert(GetTransformMatrix(model.skeleton.bindPose[i]));
+        }
+
+        model.currentPose = (Transform *)RL_CALLOC(model.skeleton.boneCount, sizeof(Transform));
+        model.boneMatrices = (Matrix *)RL_CALLOC(model.skeleton.boneCount, sizeof(Matrix));
+        for (unsigned int i = 0; i < model.skeleton.boneCount; i++) model.boneMatrices[i] = MatrixIdentity();
+    }
+
+    UnloadFileData(fileData);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Binary model loaded successfully (%i meshes, %i materials)", fileName, model.meshCount, model.materialCount);
+
+    return model;
+}
+
+// Export model and animations as binary model file (.rlm), loaded without any processing
+// NOTE: Levels of detail, mesh instances and skeleton are exported, materials shaders are not
+// exported (default shader on loading), textures pixel data is embedded (compressed formats not supported)
+bool ExportModelBinary(Model model, const ModelAnimation *animations, int animCount, const char *fileName)
+{
+    const unsigned int endianness = 1;
+
+    if (*(const unsigned char *)&endianness != 1)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Binary model files not supported on big-endian platforms", fileName);
+        return false;
+    }
+
+    ModelFileBuffer buffer = { 0 };
+    ModelFileHeader header = { 0 };
+
+    // Header space, header data filled at the end
+    AddModelFileBlock(&buffer, &header, sizeof(ModelFileHeader));
+
+    // Meshes data, model meshes followed by levels of detail meshes
+    int lodCount = ((model.lodMeshes != NULL) && (model.lodScreenSizes != NULL))? model.lodCount : 0;
+    int meshCount = model.meshCount*(lodCount + 1);
+    ModelFileMesh *meshes = (ModelFileMesh *)RL_CALLOC((meshCount > 0)? meshCount : 1, sizeof(ModelFileMesh));
+
+    for (int i = 0; i < meshCount; i++)
+    {
+        Mesh mesh = (i < model.meshCount)? model.meshes[i] : model.lodMeshes[i - model.meshCount];
+        void **attributes[MODEL_FILE_ATTRIBUTE_COUNT] = { 0 };
+        int sizes[MODEL_FILE_ATTRIBUTE_COUNT] = { 0 };
+        GetModelFileAttributes(&mesh, attributes, sizes);
+
+        meshes[i].vertexCount = mesh.vertexCount;
+        meshes[i].triangleCount = mesh.triangleCount;
+        meshes[i].boneCount = mesh.boneCount;
+        meshes[i].material = ((i < model.meshCount) && (model.meshMaterial != NULL))? model.meshMaterial[i] : 0;
+
+        for (int k = 0; k < MODEL_FILE_ATTRIBUTE_COUNT; k++)
+        {
+            int count = ((k == MODEL_FILE_INDICES) || (k == MODEL_FILE_INDICES32))? mesh.triangleCount : mesh.vertexCount;
+            meshes[i].attributes[k] = AddModelFileBlock(&buffer, *attributes[k], (size_t)count*sizes[k]);
+        }
+    }
+
+    // Materials data, maps textures exported once (referenced by index)
+    ModelFileMaterial *materials = (ModelFileMaterial *)RL_CALLOC((model.materialCount > 0)? model.materialCount : 1, sizeof(ModelFileMaterial));
+    ModelFileTexture *textures = (ModelFileTexture *)RL_CALLOC((model.materialCount > 0)? model.materialCount*MAX_MATERIAL_MAPS : 1, sizeof(ModelFileTexture));
+    unsigned int *textureIds = (unsigned int *)RL_CALLOC((model.materialCount > 0)? model.materialCount*MAX_MATERIAL_MAPS : 1, sizeof(unsigned int));
+    int textureCount = 0;
+
+    for (int i = 0; i < model.materialCount; i++)
+    {
+        for (int k = 0; k < 4; k++) materials[i].params[k] = model.materials[i].params[k];
+
+        for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+        {
+            MaterialMap map = (model.materials[i].maps != NULL)? model.materials[i].maps[m] : (MaterialMap){ 0 };
+            int texture = -1;
+
+            // NOTE: Unset maps are zeroed, default texture id could be 0 on some backends
+            if ((map.texture.id == 0) && (map.texture.width == 0)) texture = -1;
+            else if (map.texture.id == rlGetTextureIdDefault()) texture = -2;
+            else if (map.texture.id == 0) texture = -1;
+            else
+            {
+                for (int t = 0; (t < textureCount) && (texture == -1); t++)
+                {
+                    if (textureIds[t] == map.texture.id) texture = t;
+                }
+
+                if (texture == -1)
+                {
+                    // NOTE: Textures failing pixel data retrieval are exported without data (no texture on loading)
+                    Image image = LoadImageFromTexture(map.texture);
+
+                    textures[textureCount].width = image.width;
+                    textures[textureCount].height = image.height;
+                    textures[textureCount].mipmaps = map.texture.mipmaps;
+                    textures[textureCount].format = image.format;
+                    if (image.data != NULL) textures[textureCount].data = AddModelFileBlock(&buffer, image.data, GetPixelDataSize(image.width, image.height, image.format));
+                    textureIds[textureCount] = map.texture.id;
+                    texture = textureCount;
+                    textureCount++;
+
+                    UnloadImage(image);
+                }
+            }
+
+            materials[i].textures[m] = texture;
+            materials[i].colors[m] = map.color;
+            materials[i].values[m] = map.value;
+        }
+    }
+
+    // Animations data, compressed clips exported compressed
+    ModelFileAnimation *anims = (ModelFileAnimation *)RL_CALLOC((animCount > 0)? animCount : 1, sizeof(ModelFileAnimation));
+
+    for (int a = 0; a < animCount; a++)
+    {
+        memcpy(anims[a].name, animations[a].name, sizeof(anims[a].name));
+        anims[a].boneCount = animations[a].boneCount;
+        anims[a].keyframeCount = animations[a].keyframeCount;
+
+        if (animations[a].clip != NULL)
+        {
+            anims[a].keyCount = animations[a].clip->keyCount;
+            anims[a].tracks = AddModelFileBlock(&buffer, animations[a].clip->tracks, animations[a].boneCount*3*sizeof(AnimationTrack));
+            anims[a].keyFrames = AddModelFileBlock(&buffer, animations[a].clip->keyFrames, animations[a].clip->keyCount*sizeof(unsigned short));
+            anims[a].keyValues = AddModelFileBlock(&buffer, animations[a].clip->keyValues, animations[a].clip->keyCount*3*sizeof(unsigned short));
+        }
+        else if ((animations[a].keyframePoses != NULL) && (animations[a].keyframeCount > 0))
+        {
+            // Keyframe poses stored consecutive
+            size_t poseSize = animations[a].boneCount*sizeof(Transform);
+            unsigned char *poses = (unsigned char *)RL_MALLOC(animations[a].keyframeCount*poseSize);
+
+            for (int f = 0; f < animations[a].keyframeCount; f++) memcpy(poses + f*poseSize, animations[a].keyframePoses[f], poseSize);
+
+            anims[a].keyframePoses = AddModelFileBlock(&buffer, poses, animations[a].keyframeCount*poseSize);
+            RL_FREE(poses);
+        }
+    }
+
+    // Records and model arrays
+    memcpy(header.id, "rLMF", 4);
+    header.version = MODEL_FILE_VERSION;
+    header.meshCount = model.meshCount;
+    header.materialCount = model.materialCount;
+    header.textureCount = textureCount;
+    header.boneCount = (model.skeleton.bones != NULL)? (int)model.skeleton.boneCount : 0;
+    header.lodCount = lodCount;
+    header.instanceCount = model.instanceCount;
+    header.animCount = animCount;
+    header.meshes = AddModelFileBlock(&buffer, meshes, meshCount*sizeof(ModelFileMesh));
+    header.materials = AddModelFileBlock(&buffer, materials, model.materialCount*sizeof(ModelFileMaterial));
+    header.textures = AddModelFileBlock(&buffer, textures, textureCount*sizeof(ModelFileTexture));
+    header.bones = AddModelFileBlock(&buffer, model.skeleton.bones, header.boneCount*sizeof(BoneInfo));
+    header.bindPose = AddModelFileBlock(&buffer, model.skeleton.bindPose, header.boneCount*sizeof(Transform));
+    header.invBindMatrices = AddModelFileBlock(&buffer, model.skeleton.invBindMatrices, header.boneCount*sizeof(Matrix));
+    header.lodScreenSizes = AddModelFileBlock(&buffer, model.lodScreenSizes, header.lodCount*sizeof(float));
+    header.instanceMeshes = AddModelFileBlock(&buffer, model.instanceMeshes, model.instanceCount*sizeof(int));
+    header.instanceTransforms = AddModelFileBlock(&buffer, model.instanceTransforms, model.instanceCount*sizeof(Matrix));
+    header.animations = AddModelFileBlock(&buffer, anims, animCount*sizeof(ModelFileAnimation));
+    header.fileSize = buffer.size;
+
+    memcpy(buffer.data, &header, sizeof(ModelFileHeader));
+
+    bool result = SaveFileData(fileName, buffer.data, buffer.size);
+
+    RL_FREE(meshes);
+    RL_FREE(materials);
+    RL_FREE(textures);
+    RL_FREE(textureIds);
+    RL_FREE(anims);
+    RL_FREE(buffer.data);
+
+    return result;
+}
+
 // Check if model is valid (loaded in GPU, VAO/VBOs)
 bool IsModelValid(Model model)
 {
@@ -1199,7 +1916,7 @@ bool IsModelValid(Model model)
         if ((model.meshes[i].colors != NULL) && (model.meshes[i].vboId[3] == 0)) { result = false; break; }     // Vertex colors buffer not uploaded to GPU
         if ((model.meshes[i].tangents != NULL) && (model.meshes[i].vboId[4] == 0)) { result = false; break; }   // Vertex tangents buffer not uploaded to GPU
         if ((model.meshes[i].texcoords2 != NULL) && (model.meshes[i].vboId[5] == 0)) { result = false; break; } // Vertex texcoords2 buffer not uploaded to GPU
-        if ((model.meshes[i].indices != NULL) && (model.meshes[i].vboId[6] == 0)) { result = false; break; }    // Vertex indices buffer not uploaded to GPU
+        if (((model.meshes[i].indices != NULL) || (model.meshes[i].indices32 != NULL)) && (model.meshes[i].vboId[6] == 0)) { result = false; break; } // Vertex indices buffer not uploaded to GPU
 #if SUPPORT_GPU_SKINNING
         if ((model.meshes[i].boneIndices != NULL) && (model.meshes[i].vboId[7] == 0)) { result = false; break; } // Vertex boneIndices buffer not uploaded to GPU
         if ((model.meshes[i].boneWeights != NULL) && (model.meshes[i].vboId[8] == 0)) { result = false; break; } // Vertex boneWeights buffer not uploaded to GPU
@@ -1233,9 +1950,19 @@ void UnloadModel(Model model)
     // Unload animation data
     RL_FREE(model.skeleton.bones);
     RL_FREE(model.skeleton.bindPose);
+    RL_FREE(model.skeleton.invBindMatrices);
     RL_FREE(model.currentPose);
     RL_FREE(model.boneMatrices);
 
+    // Unload levels of detail
+    for (int i = 0; i < model.lodCount*model.meshCount; i++) UnloadMesh(model.lodMeshes[i]);
+    RL_FREE(model.lodMeshes);
+    RL_FREE(model.lodScreenSizes);
+
+    // Unload mesh instances
+    RL_FREE(model.instanceMeshes);
+    RL_FREE(model.instanceTransforms);
+
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
 
@@ -1244,7 +1971,27 @@ BoundingBox GetModelBoundingBox(Model model)
 {
     BoundingBox bounds = { 0 };
 
-    if (model.meshCount > 0)
+    if (model.instanceCount > 0)
+    {
+        // Mesh instances bounds, every mesh bounds transformed by instances transform
+        BoundingBox *meshBounds = (BoundingBox *)RL_MALLOC(model.meshCount*sizeof(BoundingBox));
+        for (int i = 0; i < model.meshCount; i++) meshBounds[i] = GetMeshBoundingBox(model.meshes[i]);
+
+        for (int i = 0; i < model.instanceCount; i++)
+        {
+            BoundingBox instanceBounds = GetBoundingBoxTransformed(meshBounds[model.instanceMeshes[i]], model.instanceTransforms[i]);
+
+            if (i == 0) bounds = instanceBounds;
+            else
+            {
+                bounds.min = Vector3Min(bounds.min, instanceBounds.min);
+                bounds.max = Vector3Max(bounds.max, instanceBounds.max);
+            }
+        }
+
+        RL_FREE(meshBounds);
+    }
+    else if (model.meshCount > 0)
     {
         Vector3 temp = { 0 };
         bounds = GetMeshBoundingBox(model.meshes[0]);
@@ -1286,6 +2033,11 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 
     mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
 
+    // Cache mesh bounds for culling
+    // NOTE: Dynamic meshes vertex positions can be updated with UpdateMeshBuffer(),
+    // bounds are not cached so they are never culled (unless mesh.bounds is set by user)
+    if (!dynamic) mesh->bounds = GetMeshBoundingBox(*mesh);
+
     mesh->vaoId = 0;        // Vertex Array Object
     mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = 0;     // Vertex buffer: positions
     mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD] = 0;     // Vertex buffer: texcoords
@@ -1428,7 +2180,11 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     }
 #endif
 
-    if (mesh->indices != NULL)
+    if (mesh->indices32 != NULL)
+    {
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices32, mesh->triangleCount*3*sizeof(unsigned int), dynamic);
+    }
+    else if (mesh->indices != NULL)
     {
         mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
     }
@@ -1449,6 +2205,9 @@ void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int
 // Draw a 3d mesh with material and transform
 void DrawMesh(Mesh mesh, Material material, Matrix transform)
 {
+    // Skip meshes outside view frustum
+    if (!IsMeshVisible(mesh, material, transform)) return;
+
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_SOFTWARE)
     #define GL_VERTEX_ARRAY         0x8074
     #define GL_NORMAL_ARRAY         0x8075
@@ -1474,7 +2233,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
                    material.maps[MATERIAL_MAP_DIFFUSE].color.b,
                    material.maps[MATERIAL_MAP_DIFFUSE].color.a);
 
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
+        if (mesh.indices32 != NULL) rlDrawVertexArrayElementsEx(0, mesh.triangleCount*3, mesh.indices32, RL_UNSIGNED_INT);
+        else if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
         else rlDrawVertexArray(0, mesh.vertexCount);
     rlPopMatrix();
 
@@ -1644,7 +2404,7 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         }
 #endif
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        if ((mesh.indices != NULL) || (mesh.indices32 != NULL)) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
     }
 
     int eyeCount = 1;
@@ -1666,7 +2426,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
+        if (mesh.indices32 != NULL) rlDrawVertexArrayElementsEx(0, mesh.triangleCount*3, 0, RL_UNSIGNED_INT);
+        else if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
@@ -1703,6 +2464,71 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 // Draw multiple mesh instances with material and different transforms
 void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    // NOTE: No hardware instancing available, vertex arrays and material state are set once for all instances,
+    // every instance only sets its transform and it is rejected if mesh bounding box is outside view frustum
+    #define GL_VERTEX_ARRAY         0x8074
+    #define GL_NORMAL_ARRAY         0x8075
+    #define GL_COLOR_ARRAY          0x8076
+    #define GL_TEXTURE_COORD_ARRAY  0x8078
+
+    if ((transforms == NULL) || (instances <= 0)) return;
+
+    // Get mesh bounding box from drawn vertex positions, cached bounds are used for static meshes
+    BoundingBox bounds = mesh.bounds;
+    if ((mesh.animVertices != NULL) || !IsMeshBoundsCached(mesh))
+    {
+        Mesh boundsMesh = mesh;
+        if (mesh.animVertices != NULL) boundsMesh.vertices = mesh.animVertices;
+        bounds = GetMeshBoundingBox(boundsMesh);
+    }
+
+    // NOTE: At this point the modelview matrix contains the view matrix (camera)
+    Matrix matViewProjection = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+
+    if ((mesh.texcoords != NULL) && (material.maps[MATERIAL_MAP_DIFFUSE].texture.id > 0)) rlEnableTexture(material.maps[MATERIAL_MAP_DIFFUSE].texture.id);
+
+    if (mesh.animVertices != NULL) rlEnableStatePointer(GL_VERTEX_ARRAY, mesh.animVertices);
+    else rlEnableStatePointer(GL_VERTEX_ARRAY, mesh.vertices);
+
+    if (mesh.texcoords) rlEnableStatePointer(GL_TEXTURE_COORD_ARRAY, mesh.texcoords);
+
+    if (mesh.animNormals != NULL) rlEnableStatePointer(GL_NORMAL_ARRAY, mesh.animNormals);
+    else if (mesh.normals != NULL) rlEnableStatePointer(GL_NORMAL_ARRAY, mesh.normals);
+
+    if (mesh.colors != NULL) rlEnableStatePointer(GL_COLOR_ARRAY, mesh.colors);
+
+    rlColor4ub(material.maps[MATERIAL_MAP_DIFFUSE].color.r,
+               material.maps[MATERIAL_MAP_DIFFUSE].color.g,
+               material.maps[MATERIAL_MAP_DIFFUSE].color.b,
+               material.maps[MATERIAL_MAP_DIFFUSE].color.a);
+
+    for (int i = 0; i < instances; i++)
+    {
+        // Reject instances outside view frustum (if mesh culling enabled)
+        if (meshCulling && !CheckCollisionBoxFrustum(bounds, GetMatrixFrustum(MatrixMultiply(transforms[i], matViewProjection))))
+        {
+            meshCulledCount++;
+            continue;
+        }
+
+        rlPushMatrix();
+            rlMultMatrixf(MatrixToFloat(transforms[i]));
+
+            if (mesh.indices32 != NULL) rlDrawVertexArrayElementsEx(0, mesh.triangleCount*3, mesh.indices32, RL_UNSIGNED_INT);
+            else if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
+            else rlDrawVertexArray(0, mesh.vertexCount);
+        rlPopMatrix();
+    }
+
+    rlDisableStatePointer(GL_VERTEX_ARRAY);
+    rlDisableStatePointer(GL_TEXTURE_COORD_ARRAY);
+    rlDisableStatePointer(GL_NORMAL_ARRAY);
+    rlDisableStatePointer(GL_COLOR_ARRAY);
+
+    rlDisableTexture();
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Instancing required variables
     float16 *instanceTransform = NULL;
@@ -1883,7 +2709,7 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         }
 #endif
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        if ((mesh.indices != NULL) || (mesh.indices32 != NULL)) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
     }
 
     int eyeCount = 1;
@@ -1905,7 +2731,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
+        if (mesh.indices32 != NULL) rlDrawVertexArrayElementsInstancedEx(0, mesh.triangleCount*3, 0, instances, RL_UNSIGNED_INT);
+        else if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
         else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
 
@@ -1956,6 +2783,7 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.tangents);
     RL_FREE(mesh.texcoords2);
     RL_FREE(mesh.indices);
+    RL_FREE(mesh.indices32);
 
     // Unload mesh skin animation data
     RL_FREE(mesh.boneWeights);
@@ -2014,14 +2842,16 @@ bool ExportMesh(Mesh mesh, const char *fileName)
             byteCount += sprintf(txtData + byteCount, "vn %.4f %.4f %.4f\n", mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2]);
         }
 
-        if (mesh.indices != NULL)
+        if ((mesh.indices != NULL) || (mesh.indices32 != NULL))
         {
             for (int i = 0, v = 0; i < mesh.triangleCount; i++, v += 3)
             {
-                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n",
-                    mesh.indices[v] + 1, mesh.indices[v] + 1, mesh.indices[v] + 1,
-                    mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1,
-                    mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1);
+                unsigned int i0 = (mesh.indices32 != NULL)? mesh.indices32[v] : mesh.indices[v];
+                unsigned int i1 = (mesh.indices32 != NULL)? mesh.indices32[v + 1] : mesh.indices[v + 1];
+                unsigned int i2 = (mesh.indices32 != NULL)? mesh.indices32[v + 2] : mesh.indices[v + 2];
+
+                byteCount += sprintf(txtData + byteCount, "f %u/%u/%u %u/%u/%u %u/%u/%u\n",
+                    i0 + 1, i0 + 1, i0 + 1, i1 + 1, i1 + 1, i1 + 1, i2 + 1, i2 + 1, i2 + 1);
             }
         }
         else
@@ -2136,7 +2966,13 @@ bool ExportMeshAsCode(Mesh mesh, const char *fileName)
         byteCount += sprintf(txtData + byteCount, "0x%x };\n\n", mesh.colors[mesh.vertexCount*4 - 1]);
     }
 
-    if (mesh.indices != NULL)       // Vertex indices (3 index per triangle - unsigned short)
+    if (mesh.indices32 != NULL)     // Vertex indices (3 index per triangle - unsigned int)
+    {
+        byteCount += sprintf(txtData + byteCount, "static unsigned int %s_INDEX_DATA[%i] = { ", varFileName, mesh.triangleCount*3);
+        for (int i = 0; i < mesh.triangleCount*3 - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "%u,\n" : "%u, "), mesh.indices32[i]);
+        byteCount += sprintf(txtData + byteCount, "%u };\n", mesh.indices32[mesh.triangleCount*3 - 1]);
+    }
+    else if (mesh.indices != NULL)  // Vertex indices (3 index per triangle - unsigned short)
     {
         byteCount += sprintf(txtData + byteCount, "static unsigned short %s_INDEX_DATA[%i] = { ", varFileName, mesh.triangleCount*3);
         for (int i = 0; i < mesh.triangleCount*3 - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "%i,\n" : "%i, "), mesh.indices[i]);
@@ -2156,9 +2992,22 @@ bool ExportMeshAsCode(Mesh mesh, const char *fileName)
 }
 
 #if SUPPORT_FILEFORMAT_OBJ || SUPPORT_FILEFORMAT_MTL
+// Get OBJ referenced file path (materials library, textures), relative to directory
+// NOTE: Absolute paths (and NULL directory) keep file name, working directory is never changed
+static void GetFilePathOBJ(char *path, const char *directory, const char *name, int length)
+{
+    bool absolute = (name[0] == '/') || (name[0] == '\\') || ((length > 1) && (name[1] == ':'));
+
+    if ((directory == NULL) || absolute) snprintf(path, MAX_FILEPATH_LENGTH, "%.*s", length, name);
+    else snprintf(path, MAX_FILEPATH_LENGTH, "%s/%.*s", directory, length, name);
+}
+
 // Process obj materials
-static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, int materialCount)
+// NOTE: Textures paths are relative to texPath (NULL: relative to working directory)
+static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, int materialCount, const char *texPath)
 {
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+
     // Init model mats
     for (int m = 0; m < materialCount; m++)
     {
@@ -2172,21 +3021,37 @@ static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, i
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL)
+        {
+            GetFilePathOBJ(path, texPath, mats[m].diffuse_texname, (int)strlen(mats[m].diffuse_texname));
+            materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(path);  //char *diffuse_texname; // map_Kd
+        }
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
-        materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
+        if (mats[m].specular_texname != NULL)
+        {
+            GetFilePathOBJ(path, texPath, mats[m].specular_texname, (int)strlen(mats[m].specular_texname));
+            materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(path);  //char *specular_texname; // map_Ks
+        }
+        materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL)
+        {
+            GetFilePathOBJ(path, texPath, mats[m].bump_texname, (int)strlen(mats[m].bump_texname));
+            materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(path);  //char *bump_texname; // map_bump, bump
+        }
         materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL)
+        {
+            GetFilePathOBJ(path, texPath, mats[m].displacement_texname, (int)strlen(mats[m].displacement_texname));
+            materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(path);  //char *displacement_texname; // disp
+        }
     }
 }
 #endif
@@ -2208,7 +3073,7 @@ Material *LoadMaterials(const char *fileName, int *materialCount)
         if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
         materials = (Material *)RL_CALLOC(count, sizeof(Material));
-        ProcessMaterialsOBJ(materials, mats, count);
+        ProcessMaterialsOBJ(materials, mats, count, NULL);
 
         tinyobj_materials_free(mats, count);
     }
@@ -2302,6 +3167,7 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
 #if SUPPORT_FILEFORMAT_GLTF
     if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationsGLTF(fileName, animCount);
 #endif
+    if (IsFileExtension(fileName, ".rlm")) animations = LoadModelAnimationsBinary(fileName, animCount);
 
     return animations;
 }
@@ -2317,51 +3183,14 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, float frame)
     //UpdateModelAnimationEx(model, anim, frame, anim, frame, 0.0f);
 
     // Update model animated bones transform matrices for a given frame
-    if ((anim.keyframeCount > 0) && (model.skeleton.bones != NULL) && (anim.keyframePoses != NULL))
+    if ((anim.keyframeCount > 0) && (model.skeleton.bones != NULL) && ((anim.keyframePoses != NULL) || (anim.clip != NULL)))
     {
-        // Get frame and blending from frame factor required
-        int currentFrame = (int)frame;
-        int nextFrame = currentFrame + 1;
-        float blend = frame - currentFrame;
-        blend = Clamp(blend, 0.0f, 1.0f);
-        if (currentFrame >= anim.keyframeCount) currentFrame = currentFrame%anim.keyframeCount;
-        if (nextFrame >= anim.keyframeCount) nextFrame = nextFrame%anim.keyframeCount;
-
-        Matrix bindPoseMatrix = { 0 };
-        Matrix currentPoseMatrix = { 0 };
+        // Compute interpolated pose between current and next frame
+        // NOTE: Storing animation frame data in model.currentPose
+        UpdateModelAnimationPose(model, anim, frame);
 
-        // Update all bones and bone matrices of model
-        for (unsigned int boneIndex = 0; boneIndex < model.skeleton.boneCount; boneIndex++)
-        {
-            // Compute interpolated pose between current and next frame
-            // NOTE: Storing animation frame data in model.currentPose
-            model.currentPose[boneIndex].translation = Vector3Lerp(
-                anim.keyframePoses[currentFrame][boneIndex].translation,
-                anim.keyframePoses[nextFrame][boneIndex].translation, blend);
-            model.currentPose[boneIndex].rotation = QuaternionSlerp(
-                anim.keyframePoses[currentFrame][boneIndex].rotation,
-                anim.keyframePoses[nextFrame][boneIndex].rotation, blend);
-            model.currentPose[boneIndex].scale = Vector3Lerp(
-                anim.keyframePoses[currentFrame][boneIndex].scale,
-                anim.keyframePoses[nextFrame][boneIndex].scale, blend);
-
-            // Compute runtime bone matrix from model current pose
-            //-----------------------------------------------------------------------------------
-            Transform *bindPoseTransform = &model.skeleton.bindPose[boneIndex];
-            bindPoseMatrix = MatrixMultiply(
-                MatrixMultiply(MatrixScale(bindPoseTransform->scale.x, bindPoseTransform->scale.y, bindPoseTransform->scale.z),
-                    QuaternionToMatrix(bindPoseTransform->rotation)),
-                MatrixTranslate(bindPoseTransform->translation.x, bindPoseTransform->translation.y, bindPoseTransform->translation.z));
-
-            Transform *currentPoseTransform = &model.currentPose[boneIndex];
-            currentPoseMatrix = MatrixMultiply(
-                MatrixMultiply(MatrixScale(currentPoseTransform->scale.x, currentPoseTransform->scale.y, currentPoseTransform->scale.z),
-                    QuaternionToMatrix(currentPoseTransform->rotation)),
-                MatrixTranslate(currentPoseTransform->translation.x, currentPoseTransform->translation.y, currentPoseTransform->translation.z));
-
-            model.boneMatrices[boneIndex] = MatrixMultiply(MatrixInvert(bindPoseMatrix), currentPoseMatrix);
-            //-----------------------------------------------------------------------------------
-        }
+        // Compute runtime bones matrices from model current pose
+        UpdateModelBoneMatrices(model);
 
         // CPU skinning, updates CPU buffers and uploads them to GPU
         // NOTE: On GPU skinning not supported, use CPU skinning
@@ -2378,8 +3207,8 @@ void UpdateModelAnimationEx(Model model, ModelAnimation animA, float frameA, Mod
 {
     if (model.boneMatrices == NULL) return;
 
-    if ((animA.keyframeCount > 0) && (animA.keyframePoses != NULL) &&
-        (animB.keyframeCount > 0) && (animB.keyframePoses != NULL) &&
+    if ((animA.keyframeCount > 0) && ((animA.keyframePoses != NULL) || (animA.clip != NULL)) &&
+        (animB.keyframeCount > 0) && ((animB.keyframePoses != NULL) || (animB.clip != NULL)) &&
         (blend >= 0.0f) && (blend <= 1.0f))
     {
         // Inter-frame interpolation values for first animation
@@ -2398,55 +3227,17 @@ void UpdateModelAnimationEx(Model model, ModelAnimation animA, float frameA, Mod
         if (currentFrameB >= animB.keyframeCount) currentFrameB = currentFrameB%animB.keyframeCount;
         if (nextFrameB >= animB.keyframeCount) nextFrameB = nextFrameB%animB.keyframeCount;
 
-        Matrix bindPoseMatrix = { 0 };
-        Matrix currentPoseMatrix = { 0 };
-
         for (unsigned int boneIndex = 0; boneIndex < model.skeleton.boneCount; boneIndex++)
         {
-            // Get frame-interpolation for first animation
-            Vector3 frameATranslation = Vector3Lerp(
-                animA.keyframePoses[currentFrameA][boneIndex].translation,
-                animA.keyframePoses[nextFrameA][boneIndex].translation, blendA);
-            Quaternion frameARotation = QuaternionSlerp(
-                animA.keyframePoses[currentFrameA][boneIndex].rotation,
-                animA.keyframePoses[nextFrameA][boneIndex].rotation, blendA);
-            Vector3 frameAScale = Vector3Lerp(
-                animA.keyframePoses[currentFrameA][boneIndex].scale,
-                animA.keyframePoses[nextFrameA][boneIndex].scale, blendA);
-
-            // Get frame-interpolation for second animation
-            Vector3 frameBTranslation = Vector3Lerp(
-                animB.keyframePoses[currentFrameB][boneIndex].translation,
-                animB.keyframePoses[nextFrameB][boneIndex].translation, blendB);
-            Quaternion frameBRotation = QuaternionSlerp(
-                animB.keyframePoses[currentFrameB][boneIndex].rotation,
-                animB.keyframePoses[nextFrameB][boneIndex].rotation, blendB);
-            Vector3 frameBScale = Vector3Lerp(
-                animB.keyframePoses[currentFrameB][boneIndex].scale,
-                animB.keyframePoses[nextFrameB][boneIndex].scale, blendB);
+            // Get frame-interpolation for first and second animation
+            Transform frameA = GetAnimationBonePose(animA, boneIndex, currentFrameA, nextFrameA, blendA);
+            Transform frameB = GetAnimationBonePose(animB, boneIndex, currentFrameB, nextFrameB, blendB);
 
             // Compute interpolated pose between both animations frames
             // NOTE: Storing animation frame data in model.currentPose
-            model.currentPose[boneIndex].translation = Vector3Lerp(frameATranslation, frameBTranslation, blend);
-            model.currentPose[boneIndex].rotation = QuaternionSlerp(frameARotation, frameBRotation, blend);
-            model.currentPose[boneIndex].scale = Vector3Lerp(frameAScale, frameBScale, blend);
-
-            // Compute runtime bone matrix from model current pose
-            //-----------------------------------------------------------------------------------
-            Transform *bindPoseTransform = &model.skeleton.bindPose[boneIndex];
-            bindPoseMatrix = MatrixMultiply(
-                MatrixMultiply(MatrixScale(bindPoseTransform->scale.x, bindPoseTransform->scale.y, bindPoseTransform->scale.z),
-                    QuaternionToMatrix(bindPoseTransform->rotation)),
-                MatrixTranslate(bindPoseTransform->translation.x, bindPoseTransform->translation.y, bindPoseTransform->translation.z));
-
-            Transform *currentPoseTransform = &model.currentPose[boneIndex];
-            currentPoseMatrix = MatrixMultiply(
-                MatrixMultiply(MatrixScale(currentPoseTransform->scale.x, currentPoseTransform->scale.y, currentPoseTransform->scale.z),
-                    QuaternionToMatrix(currentPoseTransform->rotation)),
-                MatrixTranslate(currentPoseTransform->translation.x, currentPoseTransform->translation.y, currentPoseTransform->translation.z));
-
-            model.boneMatrices[boneIndex] = MatrixMultiply(MatrixInvert(bindPoseMatrix), currentPoseMatrix);
-            //-----------------------------------------------------------------------------------
+            model.currentPose[boneIndex].translation = Vector3Lerp(frameA.translation, frameB.translation, blend);
+            model.currentPose[boneIndex].rotation = QuaternionSlerp(frameA.rotation, frameB.rotation, blend);
+            model.currentPose[boneIndex].scale = Vector3Lerp(frameA.scale, frameB.scale, blend);
 
             /*
             Vector3 outATranslation = animA.keyframePoses[currentFrameA][boneIndex].translation;
@@ -2478,79 +3269,119 @@ void UpdateModelAnimationEx(Model model, ModelAnimation animA, float frameA, Mod
             */
         }
 
+        // Compute runtime bones matrices from model current pose
+        UpdateModelBoneMatrices(model);
+
         // CPU skinning, updates CPU buffers and uploads them to GPU (if available)
         // NOTE: Fallback in case GPU skinning is not supported or enabled
         UpdateModelAnimationVertexBuffers(model);
     }
 }
 
+// Update multiple models animation data (vertex buffers / bone matrices), every model at its own frame
+// NOTE 1: Models are expected to share the same skeleton (i.e. instances of the same model file),
+// models with a different skeleton than first model or animation are skipped
+// NOTE 2: Models at the same frame reuse the pose and bone matrices of the first model at that frame,
+// CPU skinning is also skipped for models sharing meshes with it
+void UpdateModelAnimationBatch(Model *models, int modelCount, ModelAnimation anim, const float *frames)
+{
+    if ((models == NULL) || (frames == NULL) || (modelCount <= 0)) return;
+    if ((anim.keyframeCount <= 0) || ((anim.keyframePoses == NULL) && (anim.clip == NULL))) return;
+
+    ModelSkeleton skeleton = models[0].skeleton;
+    if ((skeleton.bones == NULL) || (skeleton.bindPose == NULL) || (skeleton.boneCount != anim.boneCount)) return;
+
+    // Models with unique frames already evaluated, searched to reuse poses
+    int *uniqueModels = (int *)RL_MALLOC(modelCount*sizeof(int));
+    int uniqueCount = 0;
+
+    for (int i = 0; i < modelCount; i++)
+    {
+        Model model = models[i];
+
+        if ((model.boneMatrices == NULL) || (model.currentPose == NULL)) continue;
+        if ((model.skeleton.boneCount != skeleton.boneCount) ||
+            ((model.skeleton.bindPose != skeleton.bindPose) &&
+             (memcmp(model.skeleton.bindPose, skeleton.bindPose, skeleton.boneCount*sizeof(Transform)) != 0))) continue;
+
+        // Look for a model already evaluated at same frame
+        // NOTE: Search limited to latest unique frames to avoid quadratic cost on big batches
+        int source = -1;
+        for (int j = uniqueCount - 1; (j >= 0) && (j >= uniqueCount - 64); j--)
+        {
+            if (frames[uniqueModels[j]] == frames[i]) { source = uniqueModels[j]; break; }
+        }
+
+        if (source >= 0)
+        {
+            memcpy(model.currentPose, models[source].currentPose, skeleton.boneCount*sizeof(Transform));
+            memcpy(model.boneMatrices, models[source].boneMatrices, skeleton.boneCount*sizeof(Matrix));
+
+            // Skip skinning if meshes are shared with source model, animated buffers already updated
+            if (model.meshes == models[source].meshes) continue;
+        }
+        else
+        {
+            // NOTE: Cached inverse bind matrices from first model are used if model has none
+            if (model.skeleton.invBindMatrices == NULL) model.skeleton.invBindMatrices = skeleton.invBindMatrices;
+
+            UpdateModelAnimationPose(model, anim, frames[i]);
+            UpdateModelBoneMatrices(model);
+            uniqueModels[uniqueCount] = i;
+            uniqueCount++;
+        }
+
+        // CPU skinning, updates CPU buffers and uploads them to GPU
+        UpdateModelAnimationVertexBuffers(model);
+    }
+
+    RL_FREE(uniqueModels);
+}
+
 // Update model vertex animation buffers (positions and normals)
 // NOTE: Required for CPU skinning, uploads animated vertex buffers to GPU
 static void UpdateModelAnimationVertexBuffers(Model model)
 {
+    int boneCount = (int)model.skeleton.boneCount;
+
+    if ((model.boneMatrices == NULL) || (boneCount <= 0)) return;
+
+    Mesh *meshes = (Mesh *)RL_MALLOC(model.meshCount*sizeof(Mesh));
+    bool *updated = (bool *)RL_CALLOC(model.meshCount, sizeof(bool));
+    int meshCount = 0;
+
     for (int m = 0; m < model.meshCount; m++)
     {
         Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        const int vertexValuesCount = mesh.vertexCount*3;
-
-        int boneIndex = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0f;
-        bool bufferUpdateRequired = false; // Flag to check when anim vertex information is updated
 
         // Skip if missing bone data or missing anim buffers initialization
         if ((mesh.boneWeights == NULL) || (mesh.boneIndices == NULL) ||
             (mesh.animVertices == NULL) || (mesh.animNormals == NULL)) continue;
 
-        for (int vCounter = 0; vCounter < vertexValuesCount; vCounter += 3)
-        {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
-
-            // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneIndex = mesh.boneIndices[boneCounter];
+        meshes[meshCount] = mesh;
+        meshCount++;
+    }
 
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex, model.boneMatrices[boneIndex]);
-                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                bufferUpdateRequired = true;
-
-                // Normals processing
-                // NOTE: Using meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if ((mesh.normals != NULL) && (mesh.animNormals != NULL ))
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal, MatrixTranspose(MatrixInvert(model.boneMatrices[boneIndex])));
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
-            }
-        }
+    if (meshCount > 0)
+    {
+        // All model meshes are skinned together, split in parallel tasks only once
+        float *skinMatrices = LoadSkinningMatrices(model.boneMatrices, boneCount);
+        SkinMeshes(meshes, meshCount, skinMatrices, boneCount, updated);
+        RL_FREE(skinMatrices);
+    }
 
-        if (bufferUpdateRequired)
+    for (int m = 0; m < meshCount; m++)
+    {
+        if (updated[m])
         {
             // Update GPU vertex buffers with updated data (position + normals)
-            rlUpdateVertexBuffer(mesh.vboId[SHADER_LOC_VERTEX_POSITION], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);
-            if (mesh.normals != NULL) rlUpdateVertexBuffer(mesh.vboId[SHADER_LOC_VERTEX_NORMAL], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);
+            rlUpdateVertexBuffer(meshes[m].vboId[SHADER_LOC_VERTEX_POSITION], meshes[m].animVertices, meshes[m].vertexCount*3*sizeof(float), 0);
+            if (meshes[m].normals != NULL) rlUpdateVertexBuffer(meshes[m].vboId[SHADER_LOC_VERTEX_NORMAL], meshes[m].animNormals, meshes[m].vertexCount*3*sizeof(float), 0);
         }
     }
+
+    RL_FREE(meshes);
+    RL_FREE(updated);
 }
 
 // Unload animation array data
@@ -2558,15 +3389,157 @@ void UnloadModelAnimations(ModelAnimation *animations, int animCount)
 {
     for (int a = 0; a < animCount; a++)
     {
-        for (int i = 0; i < animations[a].keyframeCount; i++)
-            RL_FREE(animations[a].keyframePoses[i]);
+        if (animations[a].keyframePoses != NULL)
+        {
+            for (int i = 0; i < animations[a].keyframeCount; i++)
+                RL_FREE(animations[a].keyframePoses[i]);
+
+            RL_FREE(animations[a].keyframePoses);
+        }
 
-        RL_FREE(animations[a].keyframePoses);
+        if (animations[a].clip != NULL)
+        {
+            RL_FREE(animations[a].clip->tracks);
+            RL_FREE(animations[a].clip->keyFrames);
+            RL_FREE(animations[a].clip->keyValues);
+            RL_FREE(animations[a].clip);
+        }
     }
 
     RL_FREE(animations);
 }
 
+// Compress model animation, keyframe poses are replaced by compressed clip data
+// NOTE 1: Rotations are quantized to 48 bits, translations and scales to 16 bits per component in track range,
+// keys that can be linearly interpolated from neighbour keys within maxError are removed
+// NOTE 2: maxError is used for translation and scale (units) and rotation (radians)
+bool CompressModelAnimation(ModelAnimation *anim, float maxError)
+{
+    if ((anim == NULL) || (anim->keyframePoses == NULL) || (anim->keyframeCount <= 0) || (anim->boneCount == 0)) return false;
+    if (anim->keyframeCount > 65535)
+    {
+        TRACELOG(LOG_WARNING, "ANIM: [%s] Animation has too many keyframes to be compressed", anim->name);
+        return false;
+    }
+
+    int frameCount = anim->keyframeCount;
+    int trackCount = anim->boneCount*3;
+
+    rAnimationClip *clip = (rAnimationClip *)RL_CALLOC(1, sizeof(rAnimationClip));
+    clip->tracks = (AnimationTrack *)RL_CALLOC(trackCount, sizeof(AnimationTrack));
+    clip->keyFrames = (unsigned short *)RL_MALLOC(trackCount*frameCount*sizeof(unsigned short));
+    clip->keyValues = (unsigned short *)RL_MALLOC(trackCount*frameCount*3*sizeof(unsigned short));
+
+    Vector4 *values = (Vector4 *)RL_MALLOC(frameCount*sizeof(Vector4));     // Track values per frame
+    Vector4 *decoded = (Vector4 *)RL_MALLOC(frameCount*sizeof(Vector4));    // Track values per frame, quantized
+    unsigned short *codes = (unsigned short *)RL_MALLOC(frameCount*3*sizeof(unsigned short));
+
+    for (int t = 0; t < trackCount; t++)
+    {
+        AnimationTrack *track = &clip->tracks[t];
+        int boneIndex = t/3;
+        bool rotation = ((t%3) == 1);
+
+        // Get track values and quantize them
+        for (int f = 0; f < frameCount; f++)
+        {
+            Transform pose = anim->keyframePoses[f][boneIndex];
+
+            if ((t%3) == 0) values[f] = (Vector4){ pose.translation.x, pose.translation.y, pose.translation.z, 0.0f };
+            else if (rotation)
+            {
+                values[f] = QuaternionNormalize(pose.rotation);
+
+                // Keep consecutive rotations in the same hemisphere, for key interpolation error measure
+                if ((f > 0) && (Vector4DotProduct(values[f], values[f - 1]) < 0.0f)) values[f] = QuaternionScale(values[f], -1.0f);
+            }
+            else values[f] = (Vector4){ pose.scale.x, pose.scale.y, pose.scale.z, 0.0f };
+        }
+
+        if (rotation)
+        {
+            for (int f = 0; f < frameCount; f++)
+            {
+                EncodeQuaternion(values[f], &codes[f*3]);
+                decoded[f] = DecodeQuaternion(&codes[f*3]);
+                if (Vector4DotProduct(decoded[f], values[f]) < 0.0f) decoded[f] = QuaternionScale(decoded[f], -1.0f);
+            }
+        }
+        else
+        {
+            Vector3 min = { values[0].x, values[0].y, values[0].z };
+            Vector3 max = min;
+
+            for (int f = 1; f < frameCount; f++)
+            {
+                min = Vector3Min(min, (Vector3){ values[f].x, values[f].y, values[f].z });
+                max = Vector3Max(max, (Vector3){ values[f].x, values[f].y, values[f].z });
+            }
+
+            track->offset[0] = min.x;
+            track->offset[1] = min.y;
+            track->offset[2] = min.z;
+            track->range[0] = max.x - min.x;
+            track->range[1] = max.y - min.y;
+            track->range[2] = max.z - min.z;
+
+            for (int f = 0; f < frameCount; f++)
+            {
+                float components[3] = { values[f].x, values[f].y, values[f].z };
+
+                for (int k = 0; k < 3; k++)
+                {
+                    float value = (track->range[k] > 0.0f)? (components[k] - track->offset[k])/track->range[k] : 0.0f;
+                    codes[f*3 + k] = (unsigned short)(Clamp(value, 0.0f, 1.0f)*65535.0f + 0.5f);
+                }
+
+                decoded[f].x = track->offset[0] + track->range[0]*(float)codes[f*3]/65535.0f;
+                decoded[f].y = track->offset[1] + track->range[1]*(float)codes[f*3 + 1]/65535.0f;
+                decoded[f].z = track->offset[2] + track->range[2]*(float)codes[f*3 + 2]/65535.0f;
+                decoded[f].w = 0.0f;
+            }
+        }
+
+        // Reduce track keys, greedy extending every linear segment while all frames are within error
+        track->keyOffset = clip->keyCount;
+
+        int start = 0;
+        AddAnimationTrackKey(clip, track, start, &codes[start*3]);
+
+        if (!IsAnimationSegmentValid(values, decoded, 0, frameCount - 1, rotation, maxError, true))
+        {
+            while (start < (frameCount - 1))
+            {
+                int end = start + 1;
+                while ((end < (frameCount - 1)) && IsAnimationSegmentValid(values, decoded, start, end + 1, rotation, maxError, false)) end++;
+
+                AddAnimationTrackKey(clip, track, end, &codes[end*3]);
+                start = end;
+            }
+        }
+    }
+
+    RL_FREE(values);
+    RL_FREE(decoded);
+    RL_FREE(codes);
+
+    // Shrink keys arrays to used size
+    clip->keyFrames = (unsigned short *)RL_REALLOC(clip->keyFrames, clip->keyCount*sizeof(unsigned short));
+    clip->keyValues = (unsigned short *)RL_REALLOC(clip->keyValues, clip->keyCount*3*sizeof(unsigned short));
+
+    TRACELOG(LOG_INFO, "ANIM: [%s] Animation compressed: %i keys (%i poses) | %i bytes (%i bytes uncompressed)", anim->name,
+        clip->keyCount, frameCount*trackCount, (int)(trackCount*sizeof(AnimationTrack) + clip->keyCount*4*sizeof(unsigned short)),
+        (int)(frameCount*anim->boneCount*sizeof(Transform)));
+
+    for (int i = 0; i < frameCount; i++) RL_FREE(anim->keyframePoses[i]);
+    RL_FREE(anim->keyframePoses);
+
+    anim->keyframePoses = NULL;
+    anim->clip = clip;
+
+    return true;
+}
+
 // Check model animation skeleton match
 // NOTE: Only number of bones and parent connections are checked
 bool IsModelAnimationValid(Model model, ModelAnimation anim)
@@ -2578,6 +3551,116 @@ bool IsModelAnimationValid(Model model, ModelAnimation anim)
     return result;
 }
 
+// Load animated instance for a shared model
+// NOTE: Only animation state is allocated (pose, bone matrices and optionally skinned vertex buffers),
+// model meshes and materials are shared, model must outlive the instance
+AnimatedInstance LoadAnimatedInstance(Model model, bool skinnedBuffers)
+{
+    AnimatedInstance instance = { 0 };
+
+    instance.model = model;
+
+    if ((model.skeleton.boneCount > 0) && (model.skeleton.bindPose != NULL))
+    {
+        instance.currentPose = (Transform *)RL_MALLOC(model.skeleton.boneCount*sizeof(Transform));
+        memcpy(instance.currentPose, model.skeleton.bindPose, model.skeleton.boneCount*sizeof(Transform));
+
+        instance.boneMatrices = (Matrix *)RL_MALLOC(model.skeleton.boneCount*sizeof(Matrix));
+        for (unsigned int i = 0; i < model.skeleton.boneCount; i++) instance.boneMatrices[i] = MatrixIdentity();
+
+        // Skinned vertex buffers only required for CPU skinned meshes
+        if (skinnedBuffers && (model.meshCount > 0))
+        {
+            instance.animVertices = (float **)RL_CALLOC(model.meshCount, sizeof(float *));
+            instance.animNormals = (float **)RL_CALLOC(model.meshCount, sizeof(float *));
+
+            for (int i = 0; i < model.meshCount; i++)
+            {
+                Mesh mesh = model.meshes[i];
+
+                if ((mesh.boneWeights == NULL) || (mesh.boneIndices == NULL) || (mesh.animVertices == NULL)) continue;
+
+                instance.animVertices[i] = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+                memcpy(instance.animVertices[i], mesh.vertices, mesh.vertexCount*3*sizeof(float));
+
+                if ((mesh.normals != NULL) && (mesh.animNormals != NULL))
+                {
+                    instance.animNormals[i] = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+                    memcpy(instance.animNormals[i], mesh.normals, mesh.vertexCount*3*sizeof(float));
+                }
+            }
+        }
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: Animated instance requires a model with skeleton");
+
+    return instance;
+}
+
+// Unload animated instance data (model is not unloaded)
+void UnloadAnimatedInstance(AnimatedInstance instance)
+{
+    if (instance.animVertices != NULL)
+    {
+        for (int i = 0; i < instance.model.meshCount; i++)
+        {
+            RL_FREE(instance.animVertices[i]);
+            RL_FREE(instance.animNormals[i]);
+        }
+    }
+
+    RL_FREE(instance.animVertices);
+    RL_FREE(instance.animNormals);
+    RL_FREE(instance.currentPose);
+    RL_FREE(instance.boneMatrices);
+}
+
+// Update animated instance pose (bone matrices and skinned vertex buffers if available)
+// NOTE: Request frame could be fractional, using a lerp interpolation between two frames
+void UpdateAnimatedInstance(AnimatedInstance instance, ModelAnimation anim, float frame)
+{
+    Model model = instance.model;
+
+    if ((instance.boneMatrices == NULL) || (instance.currentPose == NULL)) return;
+
+    if ((anim.keyframeCount > 0) && ((anim.keyframePoses != NULL) || (anim.clip != NULL)) && (anim.boneCount == model.skeleton.boneCount))
+    {
+        model.currentPose = instance.currentPose;
+        model.boneMatrices = instance.boneMatrices;
+
+        UpdateModelAnimationPose(model, anim, frame);
+        UpdateModelBoneMatrices(model);
+
+        // CPU skinning into instance buffers, uploaded to GPU on DrawModelInstance()
+        if (instance.animVertices != NULL)
+        {
+            float *skinMatrices = LoadSkinningMatrices(instance.boneMatrices, model.skeleton.boneCount);
+            Mesh *meshes = (Mesh *)RL_MALLOC(model.meshCount*sizeof(Mesh));
+            bool *updated = (bool *)RL_CALLOC(model.meshCount, sizeof(bool));
+            int meshCount = 0;
+
+            for (int m = 0; m < model.meshCount; m++)
+            {
+                Mesh mesh = model.meshes[m];
+
+                if (instance.animVertices[m] == NULL) continue;
+
+                mesh.animVertices = instance.animVertices[m];
+                mesh.animNormals = instance.animNormals[m];
+                if (mesh.animNormals == NULL) mesh.normals = NULL;
+
+                meshes[meshCount] = mesh;
+                meshCount++;
+            }
+
+            SkinMeshes(meshes, meshCount, skinMatrices, model.skeleton.boneCount, updated);
+
+            RL_FREE(meshes);
+            RL_FREE(updated);
+            RL_FREE(skinMatrices);
+        }
+    }
+}
+
 #if SUPPORT_MESH_GENERATION
 // Generate polygonal mesh
 Mesh GenMeshPoly(int sides, float radius)
@@ -2711,7 +3794,10 @@ Mesh GenMeshPlane(float width, float length, int resX, int resZ)
     mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
     mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
     mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+    // NOTE: 32bit indices only used if mesh vertices can not be indexed with 16bit
+    if (mesh.vertexCount > 65535) mesh.indices32 = (unsigned int *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned int));
+    else mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
 
     // Mesh vertices position array
     for (int i = 0; i < mesh.vertexCount; i++)
@@ -2737,7 +3823,8 @@ Mesh GenMeshPlane(float width, float length, int resX, int resZ)
     }
 
     // Mesh indices array initialization
-    for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices[i] = triangles[i];
+    if (mesh.indices32 != NULL) for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices32[i] = triangles[i];
+    else for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices[i] = triangles[i];
 
     RL_FREE(vertices);
     RL_FREE(normals);
@@ -3724,74 +4811,434 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 
     return mesh;
 }
-#endif // SUPPORT_MESH_GENERATION
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-BoundingBox GetMeshBoundingBox(Mesh mesh)
+// Generate a cubes model from pixel data, greedy meshed chunks
+// NOTE: Every chunk (chunkSize*chunkSize cubes) generates an indexed mesh, culled independently,
+// same faces are merged into bigger quads with texture coordinates in cubes units, so texture is tiled
+// (TEXTURE_WRAP_REPEAT required) and cubicmap atlas layout (GenMeshCubicmap()) is not used
+Model GenModelCubicmap(Image cubicmap, Vector3 cubeSize, int chunkSize)
 {
-    // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
+    Model model = { 0 };
 
-    if (mesh.vertices != NULL)
-    {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+    if (chunkSize <= 0) chunkSize = CUBICMAP_CHUNK_SIZE;
 
-        for (int i = 1; i < mesh.vertexCount; i++)
+    // Chunk scratch memory: worst case 6 quads per cube, face mask and rectangles
+    int cellCount = chunkSize*chunkSize;
+    int maxQuads = cellCount*6;
+    size_t scratchSize = (size_t)maxQuads*(4*8*sizeof(float) + 6*sizeof(unsigned int)) + (size_t)cellCount*(sizeof(Rectangle) + sizeof(bool));
+    unsigned char *scratch = (unsigned char *)LoadMeshScratch(scratchSize);
+
+    if (scratch == NULL) return model;
+
+    Mesh chunk = { 0 };
+    chunk.vertices = (float *)scratch;
+    chunk.normals = chunk.vertices + maxQuads*4*3;
+    chunk.texcoords = chunk.normals + maxQuads*4*3;
+    chunk.indices32 = (unsigned int *)(chunk.texcoords + maxQuads*4*2);
+    Rectangle *rects = (Rectangle *)(chunk.indices32 + maxQuads*6);
+    bool *mask = (bool *)(rects + cellCount);
+
+    Color *pixels = LoadImageColors(cubicmap);
+
+    int chunksX = (cubicmap.width + chunkSize - 1)/chunkSize;
+    int chunksZ = (cubicmap.height + chunkSize - 1)/chunkSize;
+
+    model.transform = MatrixIdentity();
+    model.meshes = (Mesh *)RL_CALLOC(chunksX*chunksZ, sizeof(Mesh));
+
+    for (int cz = 0; cz < chunksZ; cz++)
+    {
+        for (int cx = 0; cx < chunksX; cx++)
         {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            int x0 = cx*chunkSize;
+            int z0 = cz*chunkSize;
+            int width = ((x0 + chunkSize) <= cubicmap.width)? chunkSize : (cubicmap.width - x0);
+            int height = ((z0 + chunkSize) <= cubicmap.height)? chunkSize : (cubicmap.height - z0);
+
+            chunk.vertexCount = 0;
+            chunk.triangleCount = 0;
+
+            for (int face = 0; face < 8; face++)
+            {
+                for (int z = 0; z < height; z++)
+                {
+                    for (int x = 0; x < width; x++) mask[z*width + x] = IsCubicmapFaceVisible(pixels, cubicmap.width, cubicmap.height, x0 + x, z0 + z, face);
+                }
+
+                // Horizontal faces merged in both directions, vertical faces along their plane
+                bool mergeX = (face <= CUBICMAP_FACE_BACK);
+                bool mergeZ = (face <= CUBICMAP_FACE_FLOOR) || (face >= CUBICMAP_FACE_RIGHT);
+                int rectCount = GetMaskRectangles(mask, width, height, mergeX, mergeZ, rects);
+
+                for (int r = 0; r < rectCount; r++)
+                {
+                    Rectangle rec = { rects[r].x + x0, rects[r].y + z0, rects[r].width, rects[r].height };
+                    AddCubicmapQuad(&chunk, face, rec, cubeSize);
+                }
+            }
+
+            if (chunk.triangleCount == 0) continue;
+
+            // Copy chunk data from scratch memory
+            Mesh mesh = { 0 };
+            mesh.vertexCount = chunk.vertexCount;
+            mesh.vertices = (float *)LoadVertexAttributeCopy(chunk.vertices, 3*sizeof(float), chunk.vertexCount);
+            mesh.normals = (float *)LoadVertexAttributeCopy(chunk.normals, 3*sizeof(float), chunk.vertexCount);
+            mesh.texcoords = (float *)LoadVertexAttributeCopy(chunk.texcoords, 2*sizeof(float), chunk.vertexCount);
+
+            unsigned int *indices = (unsigned int *)RL_MALLOC(chunk.triangleCount*3*sizeof(unsigned int));
+            memcpy(indices, chunk.indices32, chunk.triangleCount*3*sizeof(unsigned int));
+            SetMeshIndices(&mesh, indices, chunk.triangleCount);
+
+            UploadMesh(&mesh, false);
+
+            model.meshes[model.meshCount++] = mesh;
         }
     }
 
-    // Create the bounding box
-    BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
+    UnloadImageColors(pixels);
 
-    return box;
+    // Default material for all chunks
+    model.materialCount = 1;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    TRACELOG(LOG_INFO, "MODEL: Cubicmap model generated: %i chunks", model.meshCount);
+
+    return model;
 }
 
-// Compute mesh tangents
-void GenMeshTangents(Mesh *mesh)
+// Generate a heightmap terrain model, indexed chunks with levels of detail
+// NOTE: Every chunk (chunkSize*chunkSize cells) generates a mesh with shared vertices and smooth normals (per pixel),
+// levels of detail halve grid resolution and chunks borders include skirts to hide cracks between levels,
+// use DrawModelChunks() to select level of detail per chunk, same vertex positions and texcoords as GenMeshHeightmap()
+Model GenModelHeightmap(Image heightmap, Vector3 size, int chunkSize, int lodCount)
 {
-    // Check if input mesh data is useful
-    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
-    {
-        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires vertices, texcoords and normals vertex attribute data");
-        return;
-    }
+    #define GRAY_VALUE(c) ((float)(c.r + c.g + c.b)/3.0f)
 
-    // Allocate or reallocate tangents data
-    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    else
+    Model model = { 0 };
+
+    int mapX = heightmap.width;
+    int mapZ = heightmap.height;
+
+    if ((mapX < 2) || (mapZ < 2)) return model;
+    if (chunkSize <= 0) chunkSize = HEIGHTMAP_CHUNK_SIZE;
+    while ((lodCount > 0) && ((1 << lodCount) > chunkSize)) lodCount--;
+
+    // Heights and normals per pixel, computed once for all chunks
+    float *heights = (float *)LoadMeshScratch((size_t)mapX*mapZ*(sizeof(float) + sizeof(Vector3)));
+    if (heights == NULL) return model;
+    Vector3 *normals = (Vector3 *)(heights + mapX*mapZ);
+
+    Vector3 scale = { size.x/(mapX - 1), size.y/255.0f, size.z/(mapZ - 1) };
+    Color *pixels = LoadImageColors(heightmap);
+
+    for (int i = 0; i < mapX*mapZ; i++) heights[i] = GRAY_VALUE(pixels[i])*scale.y;
+
+    UnloadImageColors(pixels);
+
+    for (int z = 0; z < mapZ; z++)
     {
-        RL_FREE(mesh->tangents);
-        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+        for (int x = 0; x < mapX; x++)
+        {
+            // Central differences (one-sided on borders)
+            int xl = (x > 0)? (x - 1) : x;
+            int xh = (x < (mapX - 1))? (x + 1) : x;
+            int zl = (z > 0)? (z - 1) : z;
+            int zh = (z < (mapZ - 1))? (z + 1) : z;
+
+            float dx = (heights[z*mapX + xh] - heights[z*mapX + xl])/((xh - xl)*scale.x);
+            float dz = (heights[zh*mapX + x] - heights[zl*mapX + x])/((zh - zl)*scale.z);
+
+            normals[z*mapX + x] = Vector3Normalize((Vector3){ -dx, 1.0f, -dz });
+        }
     }
 
-    // Allocate temporary arrays for tangents calculation
-    Vector3 *tan1 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
+    int chunksX = (mapX - 1 + chunkSize - 1)/chunkSize;
+    int chunksZ = (mapZ - 1 + chunkSize - 1)/chunkSize;
 
-    if (tan1 == NULL || tan2 == NULL)
+    model.transform = MatrixIdentity();
+    model.meshCount = chunksX*chunksZ;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+    if (lodCount > 0)
     {
-        TRACELOG(LOG_WARNING, "MESH: Failed to allocate temporary memory for tangent calculation");
-        if (tan1) RL_FREE(tan1);
-        if (tan2) RL_FREE(tan2);
-        return;
+        model.lodCount = lodCount;
+        model.lodMeshes = (Mesh *)RL_CALLOC(lodCount*model.meshCount, sizeof(Mesh));
+        model.lodScreenSizes = (float *)RL_MALLOC(lodCount*sizeof(float));
+
+        for (int l = 0; l < lodCount; l++) model.lodScreenSizes[l] = MODEL_LOD_SCREEN_SIZE/(float)(1 << l);
     }
 
-    // Process all triangles of the mesh
+    for (int cz = 0; cz < chunksZ; cz++)
+    {
+        for (int cx = 0; cx < chunksX; cx++)
+        {
+            int x0 = cx*chunkSize;
+            int z0 = cz*chunkSize;
+            int index = cz*chunksX + cx;
+
+            Rectangle chunk = { (float)x0, (float)z0, (float)chunkSize, (float)chunkSize };
+            if ((x0 + chunkSize) > (mapX - 1)) chunk.width = (float)(mapX - 1 - x0);
+            if ((z0 + chunkSize) > (mapZ - 1)) chunk.height = (float)(mapZ - 1 - z0);
+
+            model.meshes[index] = GenMeshHeightmapChunk(heights, normals, mapX, mapZ, scale, chunk, 1);
+
+            for (int l = 0; l < lodCount; l++) model.lodMeshes[l*model.meshCount + index] = GenMeshHeightmapChunk(heights, normals, mapX, mapZ, scale, chunk, 2 << l);
+        }
+    }
+
+    // Default material for all chunks
+    model.materialCount = 1;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    TRACELOG(LOG_INFO, "MODEL: Heightmap model generated: %i chunks, %i levels of detail", model.meshCount, lodCount);
+
+    return model;
+}
+
+// Generate simplified mesh, quadric error metric edge collapses
+// NOTE: Collapses stop when target triangles (ratio) or max error (relative to mesh size) is reached,
+// vertices on borders and attributes seams only collapse along them, keeping seams and borders shape,
+// normals at same position closer than MESH_LOD_SEAM_ANGLE are averaged, collapses also stop when
+// surface area lost reaches MESH_LOD_MAX_AREA_LOSS (avoiding slivers with a permissive max error)
+Mesh GenMeshLOD(Mesh mesh, float targetRatio, float maxError)
+{
+    Mesh lod = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Simplification requires vertices and triangles data");
+        return lod;
+    }
+
+    // Copy vertex data, source mesh is not modified
+    lod.vertexCount = mesh.vertexCount;
+    lod.boneCount = mesh.boneCount;
+    lod.vertices = (float *)LoadVertexAttributeCopy(mesh.vertices, 3*sizeof(float), mesh.vertexCount);
+    lod.texcoords = (float *)LoadVertexAttributeCopy(mesh.texcoords, 2*sizeof(float), mesh.vertexCount);
+    lod.texcoords2 = (float *)LoadVertexAttributeCopy(mesh.texcoords2, 2*sizeof(float), mesh.vertexCount);
+    lod.normals = (float *)LoadVertexAttributeCopy(mesh.normals, 3*sizeof(float), mesh.vertexCount);
+    lod.tangents = (float *)LoadVertexAttributeCopy(mesh.tangents, 4*sizeof(float), mesh.vertexCount);
+    lod.colors = (unsigned char *)LoadVertexAttributeCopy(mesh.colors, 4, mesh.vertexCount);
+    lod.boneIndices = (unsigned char *)LoadVertexAttributeCopy(mesh.boneIndices, 4, mesh.vertexCount);
+    lod.boneWeights = (float *)LoadVertexAttributeCopy(mesh.boneWeights, 4*sizeof(float), mesh.vertexCount);
+    lod.animVertices = (float *)LoadVertexAttributeCopy(mesh.animVertices, 3*sizeof(float), mesh.vertexCount);
+    lod.animNormals = (float *)LoadVertexAttributeCopy(mesh.animNormals, 3*sizeof(float), mesh.vertexCount);
+
+    int targetCount = (int)(mesh.triangleCount*targetRatio);
+    if (targetCount < 1) targetCount = 1;
+
+    unsigned int *indices = LoadMeshIndices(mesh);
+    int triangleCount = SimplifyMesh(&lod, indices, mesh.triangleCount, targetCount, maxError);
+
+    SetMeshIndices(&lod, indices, triangleCount);
+
+    // Remove collapsed vertices and reorder triangles for vertex cache
+    MeshOptimize(&lod, MESH_OPTIMIZE_VERTEX_CACHE | MESH_OPTIMIZE_VERTEX_FETCH);
+
+    UploadMesh(&lod, false);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh simplified: %i -> %i triangles", mesh.triangleCount, lod.triangleCount);
+
+    return lod;
+}
+
+// Generate model levels of detail, triangles halved every level
+// NOTE: Levels are selected on DrawModel*() by model screen size, screen sizes can be customized (model.lodScreenSizes)
+void GenModelLOD(Model *model, int lodCount, float maxError)
+{
+    if (model->skeleton.boneCount > 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Levels of detail not supported for animated models");
+        return;
+    }
+
+    // Unload previous levels of detail
+    for (int i = 0; i < model->lodCount*model->meshCount; i++) UnloadMesh(model->lodMeshes[i]);
+    RL_FREE(model->lodMeshes);
+    RL_FREE(model->lodScreenSizes);
+
+    model->lodCount = 0;
+    model->lodMeshes = NULL;
+    model->lodScreenSizes = NULL;
+
+    if (lodCount <= 0) return;
+
+    model->lodMeshes = (Mesh *)RL_CALLOC(lodCount*model->meshCount, sizeof(Mesh));
+    model->lodScreenSizes = (float *)RL_MALLOC(lodCount*sizeof(float));
+
+    for (int l = 0; l < lodCount; l++)
+    {
+        float ratio = 1.0f/(float)(2 << l);
+
+        for (int i = 0; i < model->meshCount; i++) model->lodMeshes[l*model->meshCount + i] = GenMeshLOD(model->meshes[i], ratio, maxError);
+
+        model->lodScreenSizes[l] = MODEL_LOD_SCREEN_SIZE/(float)(1 << l);
+    }
+
+    model->lodCount = lodCount;
+
+    TRACELOG(LOG_INFO, "MODEL: Generated %i levels of detail", lodCount);
+}
+#endif // SUPPORT_MESH_GENERATION
+
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+BoundingBox GetMeshBoundingBox(Mesh mesh)
+{
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
+    }
+
+    // Create the bounding box
+    BoundingBox box = { 0 };
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Set mesh frustum culling on drawing (enabled by default)
+// NOTE: Culled meshes are not submitted on DrawMesh() and DrawModel*(), bounds cached on UploadMesh() are used,
+// meshes uploaded as dynamic are not culled, if static mesh vertex positions are modified afterwards
+// mesh.bounds must be updated by user
+void SetMeshCulling(bool enabled)
+{
+    meshCulling = enabled;
+}
+
+// Get number of meshes culled since BeginDrawing()
+int GetMeshCulledCount(void)
+{
+    return meshCulledCount;
+}
+
+// Load mesh bounding volume hierarchy, for ray collision acceleration
+// NOTE: BVH is built from current mesh vertex positions with a binned surface area heuristic,
+// triangles vertex positions are copied in leaf order so mesh data is not required for collision tests
+MeshBVH LoadMeshBVH(Mesh mesh)
+{
+    MeshBVH bvh = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0)) return bvh;
+
+    int triangleCount = mesh.triangleCount;
+    int *triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    float *triBounds = (float *)RL_MALLOC(triangleCount*9*sizeof(float)); // Per triangle: min (XYZ), max (XYZ), centroid (XYZ)
+    bvh.vertices = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+    bvh.nodes = (MeshBVHNode *)RL_CALLOC(2*triangleCount - 1, sizeof(MeshBVHNode));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        triangles[i] = i;
+
+        for (int k = 0; k < 3; k++)
+        {
+            int vertex = (mesh.indices32 != NULL)? (int)mesh.indices32[i*3 + k] : (mesh.indices != NULL)? mesh.indices[i*3 + k] : i*3 + k;
+
+            for (int c = 0; c < 3; c++)
+            {
+                float value = mesh.vertices[vertex*3 + c];
+
+                if ((k == 0) || (value < triBounds[i*9 + c])) triBounds[i*9 + c] = value;
+                if ((k == 0) || (value > triBounds[i*9 + 3 + c])) triBounds[i*9 + 3 + c] = value;
+            }
+        }
+
+        for (int c = 0; c < 3; c++) triBounds[i*9 + 6 + c] = (triBounds[i*9 + c] + triBounds[i*9 + 3 + c])*0.5f;
+    }
+
+    BuildMeshBVHNode(&bvh, triangles, triBounds, 0, triangleCount, 0);
+
+    // Copy triangles vertex positions in leaf order
+    for (int i = 0; i < triangleCount; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            int vertex = (mesh.indices32 != NULL)? (int)mesh.indices32[triangles[i]*3 + k] : (mesh.indices != NULL)? mesh.indices[triangles[i]*3 + k] : triangles[i]*3 + k;
+
+            bvh.vertices[i*9 + k*3] = mesh.vertices[vertex*3];
+            bvh.vertices[i*9 + k*3 + 1] = mesh.vertices[vertex*3 + 1];
+            bvh.vertices[i*9 + k*3 + 2] = mesh.vertices[vertex*3 + 2];
+        }
+    }
+
+    bvh.triangleCount = triangleCount;
+
+    RL_FREE(triangles);
+    RL_FREE(triBounds);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy
+void UnloadMeshBVH(MeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.vertices);
+}
+
+// Compute mesh tangents
+void GenMeshTangents(Mesh *mesh)
+{
+    // Check if input mesh data is useful
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires vertices, texcoords and normals vertex attribute data");
+        return;
+    }
+
+    // Allocate or reallocate tangents data
+    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    else
+    {
+        RL_FREE(mesh->tangents);
+        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    }
+
+    // Allocate temporary arrays for tangents calculation
+    Vector3 *tan1 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
+    Vector3 *tan2 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
+
+    if (tan1 == NULL || tan2 == NULL)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to allocate temporary memory for tangent calculation");
+        if (tan1) RL_FREE(tan1);
+        if (tan2) RL_FREE(tan2);
+        return;
+    }
+
+    // Process all triangles of the mesh
     // 'triangleCount' must be always valid
     for (int t = 0; t < mesh->triangleCount; t++)
     {
         // Get triangle vertex indices
         int i0 = 0, i1 = 0, i2 = 0;
 
-        if (mesh->indices != NULL)
+        if (mesh->indices32 != NULL)
+        {
+            // Use 32bit indices if available
+            i0 = mesh->indices32[t*3 + 0];
+            i1 = mesh->indices32[t*3 + 1];
+            i2 = mesh->indices32[t*3 + 2];
+        }
+        else if (mesh->indices != NULL)
         {
             // Use indices if available
             i0 = mesh->indices[t*3 + 0];
@@ -3922,6 +5369,89 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Optimize mesh data for drawing, passes selected with MeshOptimizeFlags
+// NOTE: Mesh is converted to indexed, 32bit indices only used when required (vertexCount > 65535),
+// mesh is uploaded again to GPU (static) if it was already uploaded
+void MeshOptimize(Mesh *mesh, int flags)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimization requires vertices and triangles data");
+        return;
+    }
+
+    int triangleCount = mesh->triangleCount;
+    unsigned int *indices = LoadMeshIndices(*mesh);
+    unsigned int *remap = (unsigned int *)RL_MALLOC(mesh->vertexCount*sizeof(unsigned int));
+
+    // Weld duplicated vertices, degenerate triangles are removed
+    if (flags & MESH_OPTIMIZE_WELD)
+    {
+        int uniqueCount = WeldMeshVertices(*mesh, remap);
+
+        triangleCount = 0;
+        for (int t = 0; t < mesh->triangleCount; t++)
+        {
+            unsigned int a = remap[indices[t*3]];
+            unsigned int b = remap[indices[t*3 + 1]];
+            unsigned int c = remap[indices[t*3 + 2]];
+
+            if ((a != b) && (b != c) && (a != c))
+            {
+                indices[triangleCount*3] = a;
+                indices[triangleCount*3 + 1] = b;
+                indices[triangleCount*3 + 2] = c;
+                triangleCount++;
+            }
+        }
+
+        RemapMeshVertices(mesh, remap, uniqueCount);
+    }
+
+    // Reorder triangles for vertex cache and overdraw
+    if (flags & (MESH_OPTIMIZE_VERTEX_CACHE | MESH_OPTIMIZE_OVERDRAW))
+    {
+        int *clusters = (int *)RL_MALLOC((triangleCount + 1)*sizeof(int));
+        int clusterCount = OptimizeVertexCache(indices, triangleCount, mesh->vertexCount, clusters);
+
+        if (flags & MESH_OPTIMIZE_OVERDRAW) OptimizeOverdraw(indices, mesh->vertices, clusters, clusterCount);
+
+        RL_FREE(clusters);
+    }
+
+    // Reorder vertices by first use for vertex fetch, unused vertices are removed
+    if (flags & MESH_OPTIMIZE_VERTEX_FETCH)
+    {
+        memset(remap, 0xff, mesh->vertexCount*sizeof(unsigned int));
+
+        int usedCount = 0;
+        for (int i = 0; i < triangleCount*3; i++)
+        {
+            if (remap[indices[i]] == 0xffffffff) remap[indices[i]] = usedCount++;
+            indices[i] = remap[indices[i]];
+        }
+
+        RemapMeshVertices(mesh, remap, usedCount);
+    }
+
+    RL_FREE(remap);
+
+    SetMeshIndices(mesh, indices, triangleCount);
+
+    // Upload mesh again if required, vertex buffers size could change
+    if (mesh->vboId != NULL)
+    {
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
+        mesh->vboId = NULL;
+
+        UploadMesh(mesh, false);
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Mesh optimized: %i vertices, %i triangles", mesh->vertexCount, mesh->triangleCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -3945,9 +5475,20 @@ void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rota
     // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
     model.transform = MatrixMultiply(model.transform, matTransform);
 
-    for (int i = 0; i < model.meshCount; i++)
+    // Select level of detail meshes by model screen size
+    Mesh *meshes = model.meshes;
+    int lod = GetModelLOD(model, -1);
+    if (lod > 0) meshes = &model.lodMeshes[(lod - 1)*model.meshCount];
+
+    // Model drawn by mesh instances if provided, every mesh drawn once otherwise
+    int drawCount = (model.instanceCount > 0)? model.instanceCount : model.meshCount;
+
+    for (int i = 0; i < drawCount; i++)
     {
-        Material mat = model.materials[model.meshMaterial[i]];
+        int meshIndex = (model.instanceCount > 0)? model.instanceMeshes[i] : i;
+        Matrix transform = (model.instanceCount > 0)? MatrixMultiply(model.instanceTransforms[i], model.transform) : model.transform;
+
+        Material mat = model.materials[model.meshMaterial[meshIndex]];
         Color colDiffuse = mat.maps[MATERIAL_MAP_DIFFUSE].color;
 
         // Applying color tint directly to material diffuse map,
@@ -3968,13 +5509,76 @@ void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rota
             rlSetUniformMatrices(mat.shader.locs[SHADER_LOC_MATRIX_BONETRANSFORMS], model.boneMatrices, model.skeleton.boneCount);
         }
 
-        DrawMesh(model.meshes[i], mat, model.transform);
+        DrawMesh(meshes[meshIndex], mat, transform);
 
         // Restore material diffuse map color (before tint applied)
         mat.maps[MATERIAL_MAP_DIFFUSE].color = colDiffuse;
     }
 }
 
+// Draw a chunked model (i.e. terrain), level of detail selected per chunk (mesh)
+// NOTE: Chunks outside view frustum are culled, levels of detail are selected by chunk screen size
+void DrawModelChunks(Model model, Vector3 position, float scale, Color tint)
+{
+    Matrix matTransform = MatrixMultiply(MatrixScale(scale, scale, scale), MatrixTranslate(position.x, position.y, position.z));
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        int lod = GetModelLOD(model, i);
+        Mesh mesh = (lod > 0)? model.lodMeshes[(lod - 1)*model.meshCount + i] : model.meshes[i];
+
+        Material mat = model.materials[model.meshMaterial[i]];
+        Color colDiffuse = mat.maps[MATERIAL_MAP_DIFFUSE].color;
+
+        // Applying color tint directly to material diffuse map
+        Color colTinted = { 0 };
+        colTinted.r = (unsigned char)(((int)colDiffuse.r*(int)tint.r)/255);
+        colTinted.g = (unsigned char)(((int)colDiffuse.g*(int)tint.g)/255);
+        colTinted.b = (unsigned char)(((int)colDiffuse.b*(int)tint.b)/255);
+        colTinted.a = (unsigned char)(((int)colDiffuse.a*(int)tint.a)/255);
+
+        mat.maps[MATERIAL_MAP_DIFFUSE].color = colTinted;
+
+        DrawMesh(mesh, mat, model.transform);
+
+        mat.maps[MATERIAL_MAP_DIFFUSE].color = colDiffuse;
+    }
+}
+
+// Draw an animated instance of a model with custom transform
+// NOTE: Instance pose is applied to shared model meshes on drawing: bone matrices uploaded to shader
+// in case of GPU skinning, instance skinned buffers (or shared meshes skinned at this point) for CPU skinning
+void DrawModelInstance(AnimatedInstance instance, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    Model model = instance.model;
+    model.currentPose = instance.currentPose;
+    model.boneMatrices = instance.boneMatrices;
+
+    if (instance.animVertices != NULL)
+    {
+        // Copy instance skinned buffers into shared meshes animated buffers
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            Mesh mesh = model.meshes[i];
+
+            if ((instance.animVertices[i] == NULL) || (mesh.animVertices == NULL)) continue;
+
+            memcpy(mesh.animVertices, instance.animVertices[i], mesh.vertexCount*3*sizeof(float));
+            rlUpdateVertexBuffer(mesh.vboId[SHADER_LOC_VERTEX_POSITION], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);
+
+            if ((instance.animNormals[i] != NULL) && (mesh.animNormals != NULL))
+            {
+                memcpy(mesh.animNormals, instance.animNormals[i], mesh.vertexCount*3*sizeof(float));
+                rlUpdateVertexBuffer(mesh.vboId[SHADER_LOC_VERTEX_NORMAL], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);
+            }
+        }
+    }
+    else UpdateModelAnimationVertexBuffers(model);  // CPU skinning of shared meshes with instance pose
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+}
+
 // Draw a model wires (with texture if set)
 void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
 {
@@ -4158,6 +5762,60 @@ bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
     return collision;
 }
 
+// Get current view frustum (from modelview and projection matrices)
+// NOTE: Frustum is defined in world space if called after BeginMode3D(), planes are normalized
+Frustum GetViewFrustum(void)
+{
+    Frustum frustum = GetMatrixFrustum(MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection()));
+
+    for (int p = 0; p < 6; p++)
+    {
+        float length = sqrtf(frustum.planes[p].x*frustum.planes[p].x + frustum.planes[p].y*frustum.planes[p].y + frustum.planes[p].z*frustum.planes[p].z);
+        if (length > 0.0f) frustum.planes[p] = Vector4Scale(frustum.planes[p], 1.0f/length);
+    }
+
+    return frustum;
+}
+
+// Check collision between box and frustum
+// NOTE: Box is outside only when fully behind one plane, so some boxes outside
+// near frustum corners are reported as colliding (conservative)
+bool CheckCollisionBoxFrustum(BoundingBox box, Frustum frustum)
+{
+    bool collision = true;
+
+    Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+    Vector3 extent = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+
+    for (int p = 0; p < 6; p++)
+    {
+        Vector4 plane = frustum.planes[p];
+        float distance = plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w;
+        float radius = fabsf(plane.x)*extent.x + fabsf(plane.y)*extent.y + fabsf(plane.z)*extent.z;
+
+        if ((distance + radius) < 0.0f) { collision = false; break; }
+    }
+
+    return collision;
+}
+
+// Check collision between sphere and frustum
+// NOTE: Frustum planes must be normalized (i.e. GetViewFrustum()), conservative as box check
+bool CheckCollisionSphereFrustum(Vector3 center, float radius, Frustum frustum)
+{
+    bool collision = true;
+
+    for (int p = 0; p < 6; p++)
+    {
+        Vector4 plane = frustum.planes[p];
+        float distance = plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w;
+
+        if (distance < -radius) { collision = false; break; }
+    }
+
+    return collision;
+}
+
 // Get collision info between ray and sphere
 RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
 {
@@ -4273,7 +5931,13 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
             Vector3 c = { 0 };
             Vector3 *vertdata = (Vector3 *)mesh.vertices;
 
-            if (mesh.indices)
+            if (mesh.indices32)
+            {
+                a = vertdata[mesh.indices32[i*3 + 0]];
+                b = vertdata[mesh.indices32[i*3 + 1]];
+                c = vertdata[mesh.indices32[i*3 + 2]];
+            }
+            else if (mesh.indices)
             {
                 a = vertdata[mesh.indices[i*3 + 0]];
                 b = vertdata[mesh.indices[i*3 + 1]];
@@ -4303,6 +5967,133 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     return collision;
 }
 
+// Get collision info between ray and mesh using its bounding volume hierarchy
+// NOTE: Ray is transformed into mesh object space, mesh vertices are not transformed
+RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    GetRayCollisionMeshBVHBatch(&ray, 1, bvh, transform, &collision);
+
+    return collision;
+}
+
+// Get collision info between multiple rays and mesh using its bounding volume hierarchy
+// NOTE: Rays are processed in packets traversing the tree together, a node is visited
+// if any ray of the packet hits it, coherent rays (i.e. picking/view rays) share most nodes
+void GetRayCollisionMeshBVHBatch(const Ray *rays, int rayCount, MeshBVH bvh, Matrix transform, RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (rayCount <= 0)) return;
+
+    for (int i = 0; i < rayCount; i++) collisions[i] = (RayCollision){ 0 };
+
+    if ((bvh.nodes == NULL) || (bvh.nodeCount == 0)) return;
+
+    Matrix invTransform = MatrixInvert(transform);
+    float detSign = (MatrixDeterminant(transform) < 0.0f)? -1.0f : 1.0f;
+
+    Ray packetRays[MESH_BVH_RAY_PACKET_SIZE] = { 0 };
+    Vector3 invDirections[MESH_BVH_RAY_PACKET_SIZE] = { 0 };
+    int stackNodes[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+    unsigned int stackMasks[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+
+    for (int packetStart = 0; packetStart < rayCount; packetStart += MESH_BVH_RAY_PACKET_SIZE)
+    {
+        int packetSize = ((rayCount - packetStart) < MESH_BVH_RAY_PACKET_SIZE)? (rayCount - packetStart) : MESH_BVH_RAY_PACKET_SIZE;
+        RayCollision *packetCollisions = collisions + packetStart;
+        float closest[MESH_BVH_RAY_PACKET_SIZE] = { 0 };
+
+        for (int r = 0; r < packetSize; r++)
+        {
+            packetRays[r] = GetRayObjectSpace(rays[packetStart + r], invTransform);
+
+            // NOTE: Zero direction components use a big finite inverse to avoid NaN values (0*INFINITY) on box tests
+            invDirections[r].x = (packetRays[r].direction.x != 0.0f)? 1.0f/packetRays[r].direction.x : 1e30f;
+            invDirections[r].y = (packetRays[r].direction.y != 0.0f)? 1.0f/packetRays[r].direction.y : 1e30f;
+            invDirections[r].z = (packetRays[r].direction.z != 0.0f)? 1.0f/packetRays[r].direction.z : 1e30f;
+            closest[r] = INFINITY;
+        }
+
+        int stackSize = 0;
+        stackNodes[stackSize] = 0;
+        stackMasks[stackSize] = (packetSize == 32)? 0xffffffff : ((1u << packetSize) - 1);
+        stackSize++;
+
+        while (stackSize > 0)
+        {
+            stackSize--;
+            int nodeIndex = stackNodes[stackSize];
+            unsigned int mask = stackMasks[stackSize];
+            const MeshBVHNode *node = &bvh.nodes[nodeIndex];
+
+            // Keep only rays hitting node bounds closer than their current closest hit
+            for (int r = 0; r < packetSize; r++)
+            {
+                if ((mask & (1u << r)) && (GetRayBoxDistance(packetRays[r].position, invDirections[r], node->bounds, closest[r]) < 0.0f)) mask &= ~(1u << r);
+            }
+
+            if (mask == 0) continue;
+
+            if (node->triangleCount > 0)
+            {
+                // Leaf node: test its triangles against active rays
+                for (int t = node->offset; t < (node->offset + node->triangleCount); t++)
+                {
+                    const float *v = bvh.vertices + t*9;
+                    Vector3 p1 = { v[0], v[1], v[2] };
+                    Vector3 p2 = { v[3], v[4], v[5] };
+                    Vector3 p3 = { v[6], v[7], v[8] };
+
+                    for (int r = 0; r < packetSize; r++)
+                    {
+                        if (!(mask & (1u << r))) continue;
+
+                        RayCollision triHitInfo = GetRayCollisionTriangle(packetRays[r], p1, p2, p3);
+
+                        // Save the closest hit triangle
+                        if (triHitInfo.hit && (triHitInfo.distance < closest[r]))
+                        {
+                            closest[r] = triHitInfo.distance;
+                            packetCollisions[r] = triHitInfo;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // Inner node: visit first the child nearer along first active ray direction
+                int first = nodeIndex + 1;
+                int second = node->offset;
+                int r = 0;
+                while (!(mask & (1u << r))) r++;
+
+                Vector3 firstCenter = Vector3Add(bvh.nodes[first].bounds.min, bvh.nodes[first].bounds.max);
+                Vector3 secondCenter = Vector3Add(bvh.nodes[second].bounds.min, bvh.nodes[second].bounds.max);
+
+                if (Vector3DotProduct(Vector3Subtract(secondCenter, firstCenter), packetRays[r].direction) < 0.0f)
+                {
+                    int temp = first;
+                    first = second;
+                    second = temp;
+                }
+
+                stackNodes[stackSize] = second;
+                stackMasks[stackSize] = mask;
+                stackSize++;
+                stackNodes[stackSize] = first;
+                stackMasks[stackSize] = mask;
+                stackSize++;
+            }
+        }
+
+        // Hit point and normal computed once per ray, in world space
+        for (int r = 0; r < packetSize; r++)
+        {
+            if (packetCollisions[r].hit) GetRayCollisionWorldSpace(&packetCollisions[r], rays[packetStart + r], invTransform, detSign);
+        }
+    }
+}
+
 // Get collision info between ray and triangle
 // NOTE: The points are expected to be in counter-clockwise winding
 // NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
@@ -4381,1033 +6172,3837 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
-#if SUPPORT_FILEFORMAT_IQM || SUPPORT_FILEFORMAT_GLTF
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+// Build BVH node for triangles range, returns node index
+// NOTE: Nodes are stored depth-first, inner node first child is always the next node
+static int BuildMeshBVHNode(MeshBVH *bvh, int *triangles, const float *triBounds, int start, int count, int depth)
 {
-    for (int i = 0; i < boneCount; i++)
+    int nodeIndex = bvh->nodeCount;
+    bvh->nodeCount++;
+
+    // Compute node bounds and triangles centroids bounds
+    float boundsMin[3] = { 0 }, boundsMax[3] = { 0 };
+    float centroidMin[3] = { 0 }, centroidMax[3] = { 0 };
+
+    for (int i = start; i < (start + count); i++)
     {
-        if (bones[i].parent >= 0)
+        const float *tri = triBounds + triangles[i]*9;
+
+        for (int c = 0; c < 3; c++)
         {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Skipping bone not topologically sorted: Bone %d has parent %d", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
-            transforms[i].translation = Vector3Multiply(transforms[i].translation, transforms[bones[i].parent].scale);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            if ((i == start) || (tri[c] < boundsMin[c])) boundsMin[c] = tri[c];
+            if ((i == start) || (tri[3 + c] > boundsMax[c])) boundsMax[c] = tri[3 + c];
+            if ((i == start) || (tri[6 + c] < centroidMin[c])) centroidMin[c] = tri[6 + c];
+            if ((i == start) || (tri[6 + c] > centroidMax[c])) centroidMax[c] = tri[6 + c];
         }
     }
-}
-#endif
-
-#if SUPPORT_FILEFORMAT_OBJ
-// Load OBJ mesh data
-// Notes to keep in mind:
-//  - A mesh is created for every material present in the obj file
-//  - The model.meshCount is therefore the materialCount returned from tinyobj
-//  - The mesh is automatically triangulated by tinyobj
-static Model LoadOBJ(const char *fileName)
-{
-    tinyobj_attrib_t objAttributes = { 0 };
-    tinyobj_shape_t *objShapes = NULL;
-    unsigned int objShapeCount = 0;
 
-    tinyobj_material_t *objMaterials = NULL;
-    unsigned int objMaterialCount = 0;
+    bvh->nodes[nodeIndex].bounds = (BoundingBox){ { boundsMin[0], boundsMin[1], boundsMin[2] }, { boundsMax[0], boundsMax[1], boundsMax[2] } };
+    bvh->nodes[nodeIndex].offset = start;
+    bvh->nodes[nodeIndex].triangleCount = count;
 
-    Model model = { 0 };
-    model.transform = MatrixIdentity();
+    if ((count <= MESH_BVH_LEAF_TRIANGLES) || (depth >= MESH_BVH_MAX_DEPTH)) return nodeIndex;
 
-    char *fileText = LoadFileText(fileName);
+    // Find best split evaluating surface area heuristic (SAH) on bins along every axis
+    // NOTE: Half surface area is enough to compare costs
+    int bestAxis = -1;
+    int bestBin = 0;
+    float bestCost = 0.0f;
 
-    if (fileText == NULL)
+    for (int axis = 0; axis < 3; axis++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Unable to read obj file", fileName);
-        return model;
-    }
+        float extent = centroidMax[axis] - centroidMin[axis];
+        if (extent <= 0.0f) continue;
 
-    char currentDir[MAX_FILEPATH_LENGTH] = { 0 };
-    snprintf(currentDir, MAX_FILEPATH_LENGTH, "%s", GetWorkingDirectory()); // Save current working directory
-    const char *workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
-    if (CHDIR(workingDir) != 0) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+        int binCount[MESH_BVH_SAH_BINS] = { 0 };
+        float binMin[MESH_BVH_SAH_BINS][3] = { 0 };
+        float binMax[MESH_BVH_SAH_BINS][3] = { 0 };
+        float binScale = MESH_BVH_SAH_BINS/extent;
 
-    unsigned int dataSize = (unsigned int)strlen(fileText);
-
-    unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-    int ret = tinyobj_parse_obj(&objAttributes, &objShapes, &objShapeCount, &objMaterials, &objMaterialCount, fileText, dataSize, flags);
+        for (int i = start; i < (start + count); i++)
+        {
+            const float *tri = triBounds + triangles[i]*9;
+            int bin = (int)((tri[6 + axis] - centroidMin[axis])*binScale);
+            if (bin > (MESH_BVH_SAH_BINS - 1)) bin = MESH_BVH_SAH_BINS - 1;
 
-    if (ret != TINYOBJ_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: Unable to read obj data %s", fileName);
-        return model;
-    }
+            for (int c = 0; c < 3; c++)
+            {
+                if ((binCount[bin] == 0) || (tri[c] < binMin[bin][c])) binMin[bin][c] = tri[c];
+                if ((binCount[bin] == 0) || (tri[3 + c] > binMax[bin][c])) binMax[bin][c] = tri[3 + c];
+            }
 
-    UnloadFileText(fileText);
+            binCount[bin]++;
+        }
 
-    unsigned int faceVertIndex = 0;
-    unsigned int nextShape = 1;
-    int lastMaterial = -1;
-    unsigned int meshIndex = 0;
+        // Sweep from right to left accumulating right side areas, then left to right evaluating costs
+        float rightArea[MESH_BVH_SAH_BINS] = { 0 };
+        int rightCount[MESH_BVH_SAH_BINS] = { 0 };
+        float accumMin[3] = { 0 }, accumMax[3] = { 0 };
+        int accumCount = 0;
 
-    // Count meshes
-    unsigned int nextShapeEnd = objAttributes.num_face_num_verts;
+        for (int b = MESH_BVH_SAH_BINS - 1; b > 0; b--)
+        {
+            if (binCount[b] > 0)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    if ((accumCount == 0) || (binMin[b][c] < accumMin[c])) accumMin[c] = binMin[b][c];
+                    if ((accumCount == 0) || (binMax[b][c] > accumMax[c])) accumMax[c] = binMax[b][c];
+                }
 
-    // See how many verts till the next shape
-    if (objShapeCount > 1) nextShapeEnd = objShapes[nextShape].face_offset;
+                accumCount += binCount[b];
+            }
 
-    // Walk all the faces
-    for (unsigned int faceId = 0; faceId < objAttributes.num_faces; faceId++)
-    {
-        if (faceId >= nextShapeEnd)
-        {
-            // Try to find the last vert in the next shape
-            nextShape++;
-            if (nextShape < objShapeCount) nextShapeEnd = objShapes[nextShape].face_offset;
-            else nextShapeEnd = objAttributes.num_face_num_verts; // This is actually the total number of face verts in the file, not faces
-            meshIndex++;
+            float dx = accumMax[0] - accumMin[0], dy = accumMax[1] - accumMin[1], dz = accumMax[2] - accumMin[2];
+            rightArea[b] = dx*dy + dy*dz + dz*dx;
+            rightCount[b] = accumCount;
         }
-        else if ((lastMaterial != -1) && (objAttributes.material_ids[faceId] != lastMaterial))
+
+        accumCount = 0;
+
+        for (int b = 0; b < (MESH_BVH_SAH_BINS - 1); b++)
         {
-            meshIndex++; // If this is a new material, a new mesh is allocated
-        }
+            if (binCount[b] > 0)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    if ((accumCount == 0) || (binMin[b][c] < accumMin[c])) accumMin[c] = binMin[b][c];
+                    if ((accumCount == 0) || (binMax[b][c] > accumMax[c])) accumMax[c] = binMax[b][c];
+                }
 
-        lastMaterial = objAttributes.material_ids[faceId];
-        faceVertIndex += objAttributes.face_num_verts[faceId];
-    }
+                accumCount += binCount[b];
+            }
 
-    // Allocate the base meshes and materials
-    model.meshCount = meshIndex + 1;
-    model.meshes = (Mesh *)MemAlloc(sizeof(Mesh)*model.meshCount);
+            if ((accumCount == 0) || (rightCount[b + 1] == 0)) continue;
 
-    if (objMaterialCount > 0)
-    {
-        model.materialCount = objMaterialCount;
-        model.materials = (Material *)MemAlloc(sizeof(Material)*objMaterialCount);
-    }
-    else // Allocate at least one material
-    {
-        model.materialCount = 1;
-        model.materials = (Material *)MemAlloc(sizeof(Material)*1);
-    }
+            float dx = accumMax[0] - accumMin[0], dy = accumMax[1] - accumMin[1], dz = accumMax[2] - accumMin[2];
+            float cost = accumCount*(dx*dy + dy*dz + dz*dx) + rightCount[b + 1]*rightArea[b + 1];
 
-    model.meshMaterial = (int *)MemAlloc(sizeof(int)*model.meshCount);
+            if ((bestAxis < 0) || (cost < bestCost))
+            {
+                bestAxis = axis;
+                bestBin = b;
+                bestCost = cost;
+            }
+        }
+    }
 
-    // See how many verts are in each mesh
-    unsigned int *localMeshVertexCounts = (unsigned int *)MemAlloc(sizeof(unsigned int)*model.meshCount);
+    // Split only if it is cheaper than testing all triangles in a leaf
+    float dx = boundsMax[0] - boundsMin[0], dy = boundsMax[1] - boundsMin[1], dz = boundsMax[2] - boundsMin[2];
+    float leafCost = count*(dx*dy + dy*dz + dz*dx);
 
-    faceVertIndex = 0;
-    nextShapeEnd = objAttributes.num_face_num_verts;
-    lastMaterial = -1;
-    meshIndex = 0;
-    unsigned int localMeshVertexCount = 0;
+    if ((bestAxis < 0) || ((bestCost >= leafCost) && (count <= 4*MESH_BVH_LEAF_TRIANGLES))) return nodeIndex;
 
-    nextShape = 1;
-    if (objShapeCount > 1) nextShapeEnd = objShapes[nextShape].face_offset;
+    // Partition triangles by split bin
+    float binScale = MESH_BVH_SAH_BINS/(centroidMax[bestAxis] - centroidMin[bestAxis]);
+    int middle = start;
 
-    // Walk all the faces
-    for (unsigned int faceId = 0; faceId < objAttributes.num_faces; faceId++)
+    for (int i = start; i < (start + count); i++)
     {
-        bool newMesh = false; // Is a new mesh required?
-        if (faceId >= nextShapeEnd)
-        {
-            // Try to find the last vert in the next shape
-            nextShape++;
-            if (nextShape < objShapeCount) nextShapeEnd = objShapes[nextShape].face_offset;
-            else nextShapeEnd = objAttributes.num_face_num_verts; // this is actually the total number of face verts in the file, not faces
+        int bin = (int)((triBounds[triangles[i]*9 + 6 + bestAxis] - centroidMin[bestAxis])*binScale);
+        if (bin > (MESH_BVH_SAH_BINS - 1)) bin = MESH_BVH_SAH_BINS - 1;
 
-            newMesh = true;
-        }
-        else if ((lastMaterial != -1) && (objAttributes.material_ids[faceId] != lastMaterial))
+        if (bin <= bestBin)
         {
-            newMesh = true;
+            int temp = triangles[i];
+            triangles[i] = triangles[middle];
+            triangles[middle] = temp;
+            middle++;
         }
+    }
 
-        lastMaterial = objAttributes.material_ids[faceId];
+    // Avoid degenerated partitions due to floating point rounding
+    if ((middle == start) || (middle == (start + count))) middle = start + count/2;
 
-        if (newMesh)
-        {
-            localMeshVertexCounts[meshIndex] = localMeshVertexCount;
+    BuildMeshBVHNode(bvh, triangles, triBounds, start, middle - start, depth + 1);
+    int secondChild = BuildMeshBVHNode(bvh, triangles, triBounds, middle, start + count - middle, depth + 1);
 
-            localMeshVertexCount = 0;
-            meshIndex++;
-        }
+    bvh->nodes[nodeIndex].offset = secondChild;
+    bvh->nodes[nodeIndex].triangleCount = 0;
+
+    return nodeIndex;
+}
+
+// Get ray entry distance to box (slabs method), -1.0f if no hit closer than max distance
+// NOTE: Returns 0.0f if ray origin is inside the box
+static float GetRayBoxDistance(Vector3 origin, Vector3 invDirection, BoundingBox box, float maxDistance)
+{
+    float tx1 = (box.min.x - origin.x)*invDirection.x;
+    float tx2 = (box.max.x - origin.x)*invDirection.x;
+    float tNear = fminf(tx1, tx2);
+    float tFar = fmaxf(tx1, tx2);
+
+    float ty1 = (box.min.y - origin.y)*invDirection.y;
+    float ty2 = (box.max.y - origin.y)*invDirection.y;
+    tNear = fmaxf(tNear, fminf(ty1, ty2));
+    tFar = fminf(tFar, fmaxf(ty1, ty2));
+
+    float tz1 = (box.min.z - origin.z)*invDirection.z;
+    float tz2 = (box.max.z - origin.z)*invDirection.z;
+    tNear = fmaxf(tNear, fminf(tz1, tz2));
+    tFar = fminf(tFar, fmaxf(tz1, tz2));
+
+    if ((tFar < tNear) || (tFar < 0.0f) || (tNear > maxDistance)) return -1.0f;
+
+    return (tNear > 0.0f)? tNear : 0.0f;
+}
+
+// Get ray transformed into object space
+// NOTE: Direction is not normalized, so hit distances keep world space ray units
+static Ray GetRayObjectSpace(Ray ray, Matrix invTransform)
+{
+    Ray result = { 0 };
+
+    result.position = Vector3Transform(ray.position, invTransform);
+    result.direction.x = invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z;
+    result.direction.y = invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z;
+    result.direction.z = invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z;
+
+    return result;
+}
+
+// Get collision point and normal back in world space
+// NOTE: Normals are transformed by the inverse transpose matrix, flipped if transform mirrors geometry
+static void GetRayCollisionWorldSpace(RayCollision *collision, Ray ray, Matrix invTransform, float detSign)
+{
+    Vector3 normal = collision->normal;
+
+    collision->point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision->distance));
+    collision->normal.x = detSign*(invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z);
+    collision->normal.y = detSign*(invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z);
+    collision->normal.z = detSign*(invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z);
+    collision->normal = Vector3Normalize(collision->normal);
+}
+
+// Get frustum planes from clip space matrix (not normalized)
+// NOTE: Planes are extracted from matrix rows: w + x, w - x, w + y, w - y, w + z, w - z
+static Frustum GetMatrixFrustum(Matrix matrix)
+{
+    Frustum frustum = { 0 };
+
+    // Clip space rows: x, y, z, w
+    const Vector4 rows[4] = {
+        { matrix.m0, matrix.m4, matrix.m8, matrix.m12 },
+        { matrix.m1, matrix.m5, matrix.m9, matrix.m13 },
+        { matrix.m2, matrix.m6, matrix.m10, matrix.m14 },
+        { matrix.m3, matrix.m7, matrix.m11, matrix.m15 }
+    };
 
-        faceVertIndex += objAttributes.face_num_verts[faceId];
-        localMeshVertexCount += objAttributes.face_num_verts[faceId];
+    for (int p = 0; p < 6; p++)
+    {
+        float sign = ((p%2) == 0)? 1.0f : -1.0f;
+        Vector4 row = rows[p/2];
+
+        frustum.planes[p] = (Vector4){ rows[3].x + sign*row.x, rows[3].y + sign*row.y, rows[3].z + sign*row.z, rows[3].w + sign*row.w };
     }
 
-    localMeshVertexCounts[meshIndex] = localMeshVertexCount;
+    return frustum;
+}
 
-    for (int i = 0; i < model.meshCount; i++)
+// Check if mesh bounds are cached (not all zero)
+// NOTE: Bounds are cached on UploadMesh() for static meshes, dynamic meshes and meshes never uploaded keep zero bounds
+static bool IsMeshBoundsCached(Mesh mesh)
+{
+    return ((mesh.bounds.min.x != 0.0f) || (mesh.bounds.min.y != 0.0f) || (mesh.bounds.min.z != 0.0f) ||
+            (mesh.bounds.max.x != 0.0f) || (mesh.bounds.max.y != 0.0f) || (mesh.bounds.max.z != 0.0f));
+}
+
+// Check if mesh is visible on drawing (mesh culling)
+// NOTE: Only meshes with cached bounds drawn with default shader are culled, custom shaders could displace vertices,
+// skinned meshes are never culled (bind pose bounds), neither on stereo rendering (frustum per eye)
+static bool IsMeshVisible(Mesh mesh, Material material, Matrix transform)
+{
+    bool visible = true;
+
+    if (meshCulling && (mesh.boneWeights == NULL) && !rlIsStereoRenderEnabled() &&
+        (material.shader.id == rlGetShaderIdDefault()) && IsMeshBoundsCached(mesh))
     {
-        // Allocate the buffers for each mesh
-        unsigned int vertexCount = localMeshVertexCounts[i];
+        Matrix matModelViewProjection = MatrixMultiply(MatrixMultiply(MatrixMultiply(transform, rlGetMatrixTransform()),
+            rlGetMatrixModelview()), rlGetMatrixProjection());
 
-        model.meshes[i].vertexCount = vertexCount;
-        model.meshes[i].triangleCount = vertexCount/3;
+        visible = CheckCollisionBoxFrustum(mesh.bounds, GetMatrixFrustum(matModelViewProjection));
 
-        model.meshes[i].vertices = (float *)MemAlloc(sizeof(float)*vertexCount*3);
-        model.meshes[i].normals = (float *)MemAlloc(sizeof(float)*vertexCount*3);
-    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-        model.meshes[i].texcoords = (float *)MemAlloc(sizeof(float)*vertexCount*2);
-        model.meshes[i].colors = (unsigned char *)MemAlloc(sizeof(unsigned char)*vertexCount*4);
-    #else
-        if (objAttributes.texcoords != NULL && objAttributes.num_texcoords > 0)
-            model.meshes[i].texcoords = (float *)MemAlloc(sizeof(float)*vertexCount*2);
-        else model.meshes[i].texcoords = NULL;
-        model.meshes[i].colors = NULL;
-    #endif
+        if (!visible) meshCulledCount++;
     }
 
-    MemFree(localMeshVertexCounts);
-    localMeshVertexCounts = NULL;
+    return visible;
+}
 
-    // Fill meshes
-    faceVertIndex = 0;
+// Reset culled meshes counter, called on BeginDrawing()
+extern void ResetMeshCulledCount(void)
+{
+    meshCulledCount = 0;
+}
 
-    nextShapeEnd = objAttributes.num_face_num_verts;
+// Get bounding box containing transformed box
+// NOTE: Box extents transformed by absolute matrix, same result as transforming the 8 box corners
+static BoundingBox GetBoundingBoxTransformed(BoundingBox box, Matrix transform)
+{
+    Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(box.min, box.max), 0.5f), transform);
+    Vector3 extents = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
 
-    // See how many verts till the next shape
-    nextShape = 1;
-    if (objShapeCount > 1) nextShapeEnd = objShapes[nextShape].face_offset;
-    lastMaterial = -1;
-    meshIndex = 0;
-    localMeshVertexCount = 0;
+    Vector3 transformedExtents = {
+        fabsf(transform.m0)*extents.x + fabsf(transform.m4)*extents.y + fabsf(transform.m8)*extents.z,
+        fabsf(transform.m1)*extents.x + fabsf(transform.m5)*extents.y + fabsf(transform.m9)*extents.z,
+        fabsf(transform.m2)*extents.x + fabsf(transform.m6)*extents.y + fabsf(transform.m10)*extents.z
+    };
 
-    // Walk all the faces
-    for (unsigned int faceId = 0; faceId < objAttributes.num_faces; faceId++)
-    {
-        bool newMesh = false; // Is a new mesh required?
-        if (faceId >= nextShapeEnd)
-        {
-            // Try to find the last vert in the next shape
-            nextShape++;
-            if (nextShape < objShapeCount) nextShapeEnd = objShapes[nextShape].face_offset;
-            else nextShapeEnd = objAttributes.num_face_num_verts; // This is actually the total number of face verts in the file, not faces
-            newMesh = true;
-        }
+    BoundingBox result = { Vector3Subtract(center, transformedExtents), Vector3Add(center, transformedExtents) };
 
-        // If this is a new material, a new mesh is allocated
-        if (lastMaterial != -1 && objAttributes.material_ids[faceId] != lastMaterial) newMesh = true;
-        lastMaterial = objAttributes.material_ids[faceId];
+    return result;
+}
 
-        if (newMesh)
-        {
-            localMeshVertexCount = 0;
-            meshIndex++;
-        }
+// Check binary model file header: identifier, version and size
+// NOTE: File data is little-endian, not loaded on big-endian platforms
+static bool IsModelFileValid(const unsigned char *fileData, int dataSize)
+{
+    const unsigned int endianness = 1;
 
-        int matId = 0;
-        if ((lastMaterial >= 0) && (lastMaterial < (int)objMaterialCount)) matId = lastMaterial;
+    if ((fileData == NULL) || (dataSize < (int)sizeof(ModelFileHeader))) return false;
+    if (*(const unsigned char *)&endianness != 1) return false;
 
-        model.meshMaterial[meshIndex] = matId;
+    const ModelFileHeader *header = (const ModelFileHeader *)fileData;
 
-        for (int f = 0; f < objAttributes.face_num_verts[faceId]; f++)
-        {
-            int vertIndex = objAttributes.faces[faceVertIndex].v_idx;
-            int normalIndex = objAttributes.faces[faceVertIndex].vn_idx;
-            int texcordIndex = objAttributes.faces[faceVertIndex].vt_idx;
+    return (memcmp(header->id, "rLMF", 4) == 0) && (header->version == MODEL_FILE_VERSION) && (header->fileSize == (unsigned int)dataSize);
+}
 
-            for (int i = 0; i < 3; i++) model.meshes[meshIndex].vertices[localMeshVertexCount*3 + i] = objAttributes.vertices[vertIndex*3 + i];
+// Get mesh attributes data and element sizes, binary model file order (ModelFileAttribute)
+// NOTE: Element sizes are per vertex, indices element sizes are per triangle
+static void GetModelFileAttributes(Mesh *mesh, void **attributes[MODEL_FILE_ATTRIBUTE_COUNT], int sizes[MODEL_FILE_ATTRIBUTE_COUNT])
+{
+    attributes[MODEL_FILE_VERTICES] = (void **)&mesh->vertices;
+    attributes[MODEL_FILE_TEXCOORDS] = (void **)&mesh->texcoords;
+    attributes[MODEL_FILE_TEXCOORDS2] = (void **)&mesh->texcoords2;
+    attributes[MODEL_FILE_NORMALS] = (void **)&mesh->normals;
+    attributes[MODEL_FILE_TANGENTS] = (void **)&mesh->tangents;
+    attributes[MODEL_FILE_COLORS] = (void **)&mesh->colors;
+    attributes[MODEL_FILE_INDICES] = (void **)&mesh->indices;
+    attributes[MODEL_FILE_INDICES32] = (void **)&mesh->indices32;
+    attributes[MODEL_FILE_BONE_INDICES] = (void **)&mesh->boneIndices;
+    attributes[MODEL_FILE_BONE_WEIGHTS] = (void **)&mesh->boneWeights;
+
+    sizes[MODEL_FILE_VERTICES] = 3*sizeof(float);
+    sizes[MODEL_FILE_TEXCOORDS] = 2*sizeof(float);
+    sizes[MODEL_FILE_TEXCOORDS2] = 2*sizeof(float);
+    sizes[MODEL_FILE_NORMALS] = 3*sizeof(float);
+    sizes[MODEL_FILE_TANGENTS] = 4*sizeof(float);
+    sizes[MODEL_FILE_COLORS] = 4*sizeof(unsigned char);
+    sizes[MODEL_FILE_INDICES] = 3*sizeof(unsigned short);
+    sizes[MODEL_FILE_INDICES32] = 3*sizeof(unsigned int);
+    sizes[MODEL_FILE_BONE_INDICES] = 4*sizeof(unsigned char);
+    sizes[MODEL_FILE_BONE_WEIGHTS] = 4*sizeof(float);
+}
 
-            if ((objAttributes.texcoords != NULL) && (texcordIndex != TINYOBJ_INVALID_INDEX) && (texcordIndex >= 0) && (model.meshes[meshIndex].texcoords))
-            {
-                for (int i = 0; i < 2; i++) model.meshes[meshIndex].texcoords[localMeshVertexCount*2 + i] = objAttributes.texcoords[texcordIndex*2 + i];
-                model.meshes[meshIndex].texcoords[localMeshVertexCount*2 + 1] = 1.0f - model.meshes[meshIndex].texcoords[localMeshVertexCount*2 + 1];
-            }
+// Add binary model file data block, aligned (MODEL_FILE_ALIGNMENT) and padded with zeros
+// NOTE: Returns block offset from file start, 0 if no data provided
+static unsigned int AddModelFileBlock(ModelFileBuffer *buffer, const void *data, size_t size)
+{
+    if ((data == NULL) || (size == 0)) return 0;
 
-            if ((objAttributes.normals != NULL) && (normalIndex != TINYOBJ_INVALID_INDEX) && (normalIndex >= 0))
-            {
-                for (int i = 0; i < 3; i++) model.meshes[meshIndex].normals[localMeshVertexCount*3 + i] = objAttributes.normals[normalIndex*3 + i];
-            }
-            else
-            {
-                model.meshes[meshIndex].normals[localMeshVertexCount*3 + 0] = 0.0f;
-                model.meshes[meshIndex].normals[localMeshVertexCount*3 + 1] = 1.0f;
-                model.meshes[meshIndex].normals[localMeshVertexCount*3 + 2] = 0.0f;
-            }
-        #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-            for (int i = 0; i < 4; i++) model.meshes[meshIndex].colors[localMeshVertexCount*4 + i] = 255;
-        #endif
-            faceVertIndex++;
-            localMeshVertexCount++;
-        }
+    unsigned int offset = (buffer->size + MODEL_FILE_ALIGNMENT - 1)/MODEL_FILE_ALIGNMENT*MODEL_FILE_ALIGNMENT;
+
+    if ((offset + size) > buffer->capacity)
+    {
+        size_t capacity = (buffer->capacity > 0)? buffer->capacity : 4096;
+        while ((offset + size) > capacity) capacity *= 2;
+
+        buffer->data = (unsigned char *)RL_REALLOC(buffer->data, capacity);
+        buffer->capacity = capacity;
     }
 
-    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount);
-    else model.materials[0] = LoadMaterialDefault(); // Set default material for the mesh
+    memset(buffer->data + buffer->size, 0, offset - buffer->size);
+    memcpy(buffer->data + offset, data, size);
+    buffer->size = offset + (unsigned int)size;
 
-    tinyobj_attrib_free(&objAttributes);
-    tinyobj_shapes_free(objShapes, objShapeCount);
-    tinyobj_materials_free(objMaterials, objMaterialCount);
+    return offset;
+}
+
+// Check binary model file data block is within file and aligned
+// NOTE: Empty blocks are always valid, not empty blocks require an offset and elements size
+static bool IsModelFileBlockValid(unsigned int fileSize, unsigned int offset, int count, size_t elementSize)
+{
+    if (count == 0) return true;
+
+    return (count > 0) && (elementSize > 0) && (offset > 0) && ((offset%MODEL_FILE_ALIGNMENT) == 0) && (offset <= fileSize) &&
+           ((size_t)count <= (fileSize - offset)/elementSize);
+}
+
+// Check binary model file indices block values are below max value (block validated before)
+// NOTE: Element size defines indices type: 1 (bone indices), 2 (16bit indices) or 4 (32bit indices)
+static bool IsModelFileIndicesValid(const unsigned char *fileData, unsigned int offset, int count, int elementSize, unsigned int maxValue)
+{
+    if ((offset == 0) || (count <= 0)) return true;
+
+    const unsigned char *data = fileData + offset;
 
-    // Restore current working directory
-    if (CHDIR(currentDir) != 0)
+    for (int i = 0; i < count; i++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+        unsigned int value = 0;
+
+        if (elementSize == 1) value = data[i];
+        else if (elementSize == 2) value = ((const unsigned short *)data)[i];
+        else value = ((const unsigned int *)data)[i];
+
+        if (value >= maxValue) return false;
     }
 
-    return model;
+    return true;
 }
-#endif
 
-#if SUPPORT_FILEFORMAT_IQM
-// Load IQM mesh data
-static Model LoadIQM(const char *fileName)
+// Load binary model file data block copy (block validated before), NULL if not available
+static void *LoadModelFileBlock(const unsigned char *fileData, unsigned int offset, int count, size_t elementSize)
 {
-    #define IQM_MAGIC        "INTERQUAKEMODEL"  // IQM file magic number
-    #define IQM_VERSION              2          // Only IQM version 2 supported
+    if ((offset == 0) || (count <= 0)) return NULL;
 
-    #define BONE_NAME_LENGTH        32          // BoneInfo name string length
-    #define MESH_NAME_LENGTH        32          // Mesh name string length
-    #define MATERIAL_NAME_LENGTH    32          // Material name string length
+    void *block = RL_MALLOC(count*elementSize);
+    if (block != NULL) memcpy(block, fileData + offset, count*elementSize);
+
+    return block;
+}
 
+// Load binary model file animations
+static ModelAnimation *LoadModelAnimationsBinary(const char *fileName, int *animCount)
+{
+    ModelAnimation *animations = NULL;
     int dataSize = 0;
     unsigned char *fileData = LoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
 
-    // IQM file structs
-    //-----------------------------------------------------------------------------------
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int dataSize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    *animCount = 0;
 
-    typedef struct IQMMesh {
-        unsigned int name;
-        unsigned int material;
-        unsigned int first_vertex, num_vertexes;
-        unsigned int first_triangle, num_triangles;
-    } IQMMesh;
+    if (fileData == NULL) return NULL;
 
-    typedef struct IQMTriangle {
-        unsigned int vertex[3];
-    } IQMTriangle;
+    bool valid = IsModelFileValid(fileData, dataSize);
+    const ModelFileHeader *header = (const ModelFileHeader *)fileData;
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    if (valid) valid = IsModelFileBlockValid(header->fileSize, header->animations, header->animCount, sizeof(ModelFileAnimation));
 
-    typedef struct IQMVertexArray {
-        unsigned int type;
-        unsigned int flags;
-        unsigned int format;
-        unsigned int size;
-        unsigned int offset;
-    } IQMVertexArray;
+    for (int a = 0; valid && (a < header->animCount); a++)
+    {
+        const ModelFileAnimation *anim = (const ModelFileAnimation *)(fileData + header->animations) + a;
 
-    // NOTE: Below IQM structures are not used but listed for reference
-    /*
-    typedef struct IQMAdjacency {
-        unsigned int triangle[3];
-    } IQMAdjacency;
+        valid = (anim->boneCount >= 0) && (anim->keyframeCount >= 0) && (anim->keyCount >= 0);
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+        // Keyframes require bones to animate
+        if (valid && ((anim->keyframeCount > 0) || (anim->keyCount > 0))) valid = (anim->boneCount > 0);
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+        if (valid && (anim->keyCount > 0))
+        {
+            valid = IsModelFileBlockValid(header->fileSize, anim->tracks, anim->boneCount, 3*sizeof(AnimationTrack)) &&
+                    IsModelFileBlockValid(header->fileSize, anim->keyFrames, anim->keyCount, sizeof(unsigned short)) &&
+                    IsModelFileBlockValid(header->fileSize, anim->keyValues, anim->keyCount, 3*sizeof(unsigned short));
 
-    typedef struct IQMBounds {
-        float bbmin[3], bbmax[3];
-        float xyradius, radius;
-    } IQMBounds;
-    */
-    //-----------------------------------------------------------------------------------
+            // Tracks keys ranges must be within clip keys
+            const AnimationTrack *tracks = (const AnimationTrack *)(fileData + anim->tracks);
 
-    // IQM vertex data types
-    enum {
-        IQM_POSITION     = 0,
-        IQM_TEXCOORD     = 1,
-        IQM_NORMAL       = 2,
-        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
-        IQM_BLENDINDEXES = 4,
-        IQM_BLENDWEIGHTS = 5,
-        IQM_COLOR        = 6,
-        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
-    };
+            for (int t = 0; valid && (t < anim->boneCount*3); t++)
+            {
+                valid = (tracks[t].keyOffset >= 0) && (tracks[t].keyCount > 0) && (tracks[t].keyCount <= (anim->keyCount - tracks[t].keyOffset));
+            }
+        }
+        else if (valid) valid = IsModelFileBlockValid(header->fileSize, anim->keyframePoses, anim->keyframeCount, (size_t)anim->boneCount*sizeof(Transform));
+    }
 
-    Model model = { 0 };
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Binary model file not valid", fileName);
+        UnloadFileData(fileData);
+        return NULL;
+    }
 
-    IQMMesh *imesh = NULL;
-    IQMTriangle *tri = NULL;
-    IQMVertexArray *va = NULL;
-    IQMJoint *ijoint = NULL;
+    if (header->animCount > 0)
+    {
+        animations = (ModelAnimation *)RL_CALLOC(header->animCount, sizeof(ModelAnimation));
+        *animCount = header->animCount;
+    }
 
-    float *vertex = NULL;
-    float *normal = NULL;
-    float *text = NULL;
-    char *blendi = NULL;
-    unsigned char *blendw = NULL;
-    unsigned char *color = NULL;
+    for (int a = 0; a < header->animCount; a++)
+    {
+        const ModelFileAnimation *anim = (const ModelFileAnimation *)(fileData + header->animations) + a;
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return model;
+        memcpy(animations[a].name, anim->name, sizeof(animations[a].name));
+        animations[a].name[sizeof(animations[a].name) - 1] = '\0';
+        animations[a].boneCount = anim->boneCount;
+        animations[a].keyframeCount = anim->keyframeCount;
 
-    const char *basePath = GetDirectoryPath(fileName);
+        if (anim->keyCount > 0)
+        {
+            animations[a].clip = (rAnimationClip *)RL_CALLOC(1, sizeof(rAnimationClip));
+            animations[a].clip->tracks = (AnimationTrack *)LoadModelFileBlock(fileData, anim->tracks, anim->boneCount, 3*sizeof(AnimationTrack));
+            animations[a].clip->keyFrames = (unsigned short *)LoadModelFileBlock(fileData, anim->keyFrames, anim->keyCount, sizeof(unsigned short));
+            animations[a].clip->keyValues = (unsigned short *)LoadModelFileBlock(fileData, anim->keyValues, anim->keyCount, 3*sizeof(unsigned short));
+            animations[a].clip->keyCount = anim->keyCount;
+        }
+        else if (anim->keyframeCount > 0)
+        {
+            const Transform *poses = (const Transform *)(fileData + anim->keyframePoses);
+            animations[a].keyframePoses = (ModelAnimPose *)RL_CALLOC(anim->keyframeCount, sizeof(ModelAnimPose));
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+            for (int f = 0; f < anim->keyframeCount; f++)
+            {
+                animations[a].keyframePoses[f] = (Transform *)RL_MALLOC(anim->boneCount*sizeof(Transform));
+                memcpy(animations[a].keyframePoses[f], poses + f*anim->boneCount, anim->boneCount*sizeof(Transform));
+            }
+        }
+    }
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    UnloadFileData(fileData);
+
+    return animations;
+}
+
+#if SUPPORT_MESH_GENERATION
+// Load mesh generation scratch memory, grown if required
+// NOTE: Memory is kept between calls (not thread-safe), it's unloaded on CloseWindow()
+static void *LoadMeshScratch(size_t size)
+{
+    if (size > meshScratchSize)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        UnloadFileData(fileData);
-        return model;
+        unsigned char *scratch = (unsigned char *)RL_REALLOC(meshScratch, size);
+
+        if (scratch == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MESH: Failed to allocate scratch memory");
+            return NULL;
+        }
+
+        meshScratch = scratch;
+        meshScratchSize = size;
     }
 
-    if (iqmHeader->version != IQM_VERSION)
+    return meshScratch;
+}
+#endif // SUPPORT_MESH_GENERATION
+
+// Unload mesh generation scratch memory, called on CloseWindow()
+extern void UnloadMeshScratch(void)
+{
+    RL_FREE(meshScratch);
+    meshScratch = NULL;
+    meshScratchSize = 0;
+}
+
+#if SUPPORT_MESH_GENERATION
+// Generate heightmap chunk mesh, grid step (level of detail) and skirts
+// NOTE: Chunk last grid points are always included, skirts go down from borders (chunk height range)
+static Mesh GenMeshHeightmapChunk(const float *heights, const Vector3 *normals, int mapX, int mapZ, Vector3 scale, Rectangle chunk, int step)
+{
+    Mesh mesh = { 0 };
+
+    int x0 = (int)chunk.x;
+    int z0 = (int)chunk.y;
+    int cellsX = (int)chunk.width;
+    int cellsZ = (int)chunk.height;
+    int pointsX = (cellsX + step - 1)/step + 1;
+    int pointsZ = (cellsZ + step - 1)/step + 1;
+    int borderCount = 2*(pointsX - 1) + 2*(pointsZ - 1);
+
+    mesh.vertexCount = pointsX*pointsZ + borderCount*2;
+    mesh.triangleCount = (pointsX - 1)*(pointsZ - 1)*2 + borderCount*2;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+
+    unsigned int *indices = (unsigned int *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned int));
+
+    // Grid vertices, shared by cells triangles
+    float minHeight = heights[z0*mapX + x0];
+    float maxHeight = minHeight;
+
+    for (int j = 0; j < pointsZ; j++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        UnloadFileData(fileData);
-        return model;
+        for (int i = 0; i < pointsX; i++)
+        {
+            int x = x0 + (((i*step) < cellsX)? (i*step) : cellsX);
+            int z = z0 + (((j*step) < cellsZ)? (j*step) : cellsZ);
+            int v = j*pointsX + i;
+            float height = heights[z*mapX + x];
+
+            mesh.vertices[v*3] = (float)x*scale.x;
+            mesh.vertices[v*3 + 1] = height;
+            mesh.vertices[v*3 + 2] = (float)z*scale.z;
+            mesh.normals[v*3] = normals[z*mapX + x].x;
+            mesh.normals[v*3 + 1] = normals[z*mapX + x].y;
+            mesh.normals[v*3 + 2] = normals[z*mapX + x].z;
+            mesh.texcoords[v*2] = (float)x/(mapX - 1);
+            mesh.texcoords[v*2 + 1] = (float)z/(mapZ - 1);
+
+            minHeight = fminf(minHeight, height);
+            maxHeight = fmaxf(maxHeight, height);
+        }
     }
 
-    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+    // Cells triangles, same layout as GenMeshHeightmap()
+    int t = 0;
 
-    // Meshes data processing
-    imesh = (IQMMesh *)RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
-    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
-    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
-    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+    for (int j = 0; j < (pointsZ - 1); j++)
+    {
+        for (int i = 0; i < (pointsX - 1); i++)
+        {
+            unsigned int v = j*pointsX + i;
+
+            indices[t++] = v;
+            indices[t++] = v + pointsX;
+            indices[t++] = v + 1;
+            indices[t++] = v + 1;
+            indices[t++] = v + pointsX;
+            indices[t++] = v + pointsX + 1;
+        }
+    }
 
-    model.meshCount = iqmHeader->num_meshes;
-    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    // Skirts, border edges extruded down, border walked clockwise seen from above (back, right, front, left)
+    float skirtDepth = fmaxf(maxHeight - minHeight, fmaxf(scale.x, scale.z)*step);
+    unsigned int skirt = pointsX*pointsZ;
 
-    model.materialCount = model.meshCount;
-    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    for (int b = 0; b < borderCount; b++)
+    {
+        unsigned int edge[2] = { 0 };
 
-    char name[MESH_NAME_LENGTH] = { 0 };
-    char material[MATERIAL_NAME_LENGTH] = { 0 };
+        for (int k = 0; k < 2; k++)
+        {
+            int p = (b + k)%borderCount;
 
-    for (int i = 0; i < model.meshCount; i++)
+            if (p < (pointsX - 1)) edge[k] = p;
+            else if ((p -= (pointsX - 1)) < (pointsZ - 1)) edge[k] = p*pointsX + (pointsX - 1);
+            else if ((p -= (pointsZ - 1)) < (pointsX - 1)) edge[k] = (pointsZ - 1)*pointsX + (pointsX - 1 - p);
+            else edge[k] = (pointsZ - 1 - (p - (pointsX - 1)))*pointsX;
+        }
+
+        for (int k = 0; k < 2; k++)
+        {
+            unsigned int v = skirt + b*2 + k;
+
+            memcpy(&mesh.vertices[v*3], &mesh.vertices[edge[k]*3], 3*sizeof(float));
+            memcpy(&mesh.normals[v*3], &mesh.normals[edge[k]*3], 3*sizeof(float));
+            memcpy(&mesh.texcoords[v*2], &mesh.texcoords[edge[k]*2], 2*sizeof(float));
+            mesh.vertices[v*3 + 1] -= skirtDepth;
+        }
+
+        // Skirt quad, facing outwards
+        unsigned int s0 = skirt + b*2;
+
+        indices[t++] = edge[0];
+        indices[t++] = edge[1];
+        indices[t++] = s0 + 1;
+        indices[t++] = edge[0];
+        indices[t++] = s0 + 1;
+        indices[t++] = s0;
+    }
+
+    SetMeshIndices(&mesh, indices, mesh.triangleCount);
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+// Check cubicmap cube face visible (CubicmapFace)
+// NOTE: Same faces as GenMeshCubicmap(), WHITE pixels define cubes and BLACK pixels floor and roof
+static bool IsCubicmapFaceVisible(const Color *pixels, int width, int height, int x, int z, int face)
+{
+    bool visible = false;
+    bool cube = ColorIsEqual(pixels[z*width + x], WHITE);
+
+    switch (face)
     {
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[a].name, SEEK_SET);
-        //fread(name, sizeof(char), MESH_NAME_LENGTH, iqmFile);
-        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+        case CUBICMAP_FACE_TOP:
+        case CUBICMAP_FACE_BOTTOM: visible = cube; break;
+        case CUBICMAP_FACE_ROOF:
+        case CUBICMAP_FACE_FLOOR: visible = ColorIsEqual(pixels[z*width + x], BLACK); break;
+        case CUBICMAP_FACE_FRONT: visible = cube && ((z == (height - 1)) || ColorIsEqual(pixels[(z + 1)*width + x], BLACK)); break;
+        case CUBICMAP_FACE_BACK: visible = cube && ((z == 0) || ColorIsEqual(pixels[(z - 1)*width + x], BLACK)); break;
+        case CUBICMAP_FACE_RIGHT: visible = cube && ((x == (width - 1)) || ColorIsEqual(pixels[z*width + (x + 1)], BLACK)); break;
+        case CUBICMAP_FACE_LEFT: visible = cube && ((x == 0) || ColorIsEqual(pixels[z*width + (x - 1)], BLACK)); break;
+        default: break;
+    }
+
+    return visible;
+}
 
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[a].material, SEEK_SET);
-        //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
-        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+// Get mask rectangles (greedy), mask is cleared, returns rectangles count
+// NOTE: Rectangles grow first along x (rows), then along y
+static int GetMaskRectangles(bool *mask, int width, int height, bool mergeX, bool mergeY, Rectangle *rects)
+{
+    int rectCount = 0;
 
-        model.materials[i] = LoadMaterialDefault();
-        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(TextFormat("%s/%s", basePath, material));
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (!mask[y*width + x]) continue;
 
-        model.meshMaterial[i] = i;
+            int rectWidth = 1;
+            if (mergeX) while (((x + rectWidth) < width) && mask[y*width + x + rectWidth]) rectWidth++;
 
-        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+            int rectHeight = 1;
+            while (mergeY && ((y + rectHeight) < height))
+            {
+                bool filled = true;
+                for (int i = 0; (i < rectWidth) && filled; i++) filled = mask[(y + rectHeight)*width + x + i];
 
-        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+                if (!filled) break;
+                rectHeight++;
+            }
 
-        model.meshes[i].vertices = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
-        model.meshes[i].normals = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
-        model.meshes[i].texcoords = (float *)RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+            for (int j = 0; j < rectHeight; j++) memset(&mask[(y + j)*width + x], 0, rectWidth*sizeof(bool));
 
-        model.meshes[i].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
-        model.meshes[i].boneWeights = (float *)RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+            rects[rectCount++] = (Rectangle){ (float)x, (float)y, (float)rectWidth, (float)rectHeight };
+        }
+    }
 
-        model.meshes[i].triangleCount = imesh[i].num_triangles;
-        model.meshes[i].indices = (unsigned short *)RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+    return rectCount;
+}
 
-#if !SUPPORT_GPU_SKINNING
-        // Animated vertex data, processed for rendering
-        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
-        model.meshes[i].animVertices = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-        model.meshes[i].animNormals = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-#endif
+// Add cubicmap face quad covering cubes rectangle to mesh (indices32)
+// NOTE: Triangles winding and texture orientation match GenMeshCubicmap() faces
+static void AddCubicmapQuad(Mesh *mesh, int face, Rectangle rec, Vector3 cubeSize)
+{
+    float xl = cubeSize.x*(rec.x - 0.5f);
+    float xh = cubeSize.x*(rec.x + rec.width - 0.5f);
+    float zl = cubeSize.z*(rec.y - 0.5f);
+    float zh = cubeSize.z*(rec.y + rec.height - 0.5f);
+    float yt = cubeSize.y;
+
+    // Quad corners, counter-clockwise
+    Vector3 corners[4] = { 0 };
+    Vector3 normal = { 0 };
+
+    switch (face)
+    {
+        case CUBICMAP_FACE_TOP:
+        {
+            corners[0] = (Vector3){ xl, yt, zl }; corners[1] = (Vector3){ xl, yt, zh };
+            corners[2] = (Vector3){ xh, yt, zh }; corners[3] = (Vector3){ xh, yt, zl };
+            normal = (Vector3){ 0.0f, 1.0f, 0.0f };
+        } break;
+        case CUBICMAP_FACE_BOTTOM:
+        {
+            corners[0] = (Vector3){ xl, 0.0f, zl }; corners[1] = (Vector3){ xh, 0.0f, zl };
+            corners[2] = (Vector3){ xh, 0.0f, zh }; corners[3] = (Vector3){ xl, 0.0f, zh };
+            normal = (Vector3){ 0.0f, -1.0f, 0.0f };
+        } break;
+        case CUBICMAP_FACE_ROOF:
+        {
+            corners[0] = (Vector3){ xl, yt, zl }; corners[1] = (Vector3){ xh, yt, zl };
+            corners[2] = (Vector3){ xh, yt, zh }; corners[3] = (Vector3){ xl, yt, zh };
+            normal = (Vector3){ 0.0f, -1.0f, 0.0f };
+        } break;
+        case CUBICMAP_FACE_FLOOR:
+        {
+            corners[0] = (Vector3){ xl, 0.0f, zl }; corners[1] = (Vector3){ xl, 0.0f, zh };
+            corners[2] = (Vector3){ xh, 0.0f, zh }; corners[3] = (Vector3){ xh, 0.0f, zl };
+            normal = (Vector3){ 0.0f, 1.0f, 0.0f };
+        } break;
+        case CUBICMAP_FACE_FRONT:
+        {
+            corners[0] = (Vector3){ xl, yt, zh }; corners[1] = (Vector3){ xl, 0.0f, zh };
+            corners[2] = (Vector3){ xh, 0.0f, zh }; corners[3] = (Vector3){ xh, yt, zh };
+            normal = (Vector3){ 0.0f, 0.0f, 1.0f };
+        } break;
+        case CUBICMAP_FACE_BACK:
+        {
+            corners[0] = (Vector3){ xl, yt, zl }; corners[1] = (Vector3){ xh, yt, zl };
+            corners[2] = (Vector3){ xh, 0.0f, zl }; corners[3] = (Vector3){ xl, 0.0f, zl };
+            normal = (Vector3){ 0.0f, 0.0f, -1.0f };
+        } break;
+        case CUBICMAP_FACE_RIGHT:
+        {
+            corners[0] = (Vector3){ xh, yt, zh }; corners[1] = (Vector3){ xh, 0.0f, zh };
+            corners[2] = (Vector3){ xh, 0.0f, zl }; corners[3] = (Vector3){ xh, yt, zl };
+            normal = (Vector3){ 1.0f, 0.0f, 0.0f };
+        } break;
+        case CUBICMAP_FACE_LEFT:
+        {
+            corners[0] = (Vector3){ xl, yt, zl }; corners[1] = (Vector3){ xl, 0.0f, zl };
+            corners[2] = (Vector3){ xl, 0.0f, zh }; corners[3] = (Vector3){ xl, yt, zh };
+            normal = (Vector3){ -1.0f, 0.0f, 0.0f };
+        } break;
+        default: break;
     }
 
-    // Triangles data processing
-    tri = (IQMTriangle *)RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
-    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
-    //fread(tri, sizeof(IQMTriangle), iqmHeader->num_triangles, iqmFile);
-    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+    int v = mesh->vertexCount;
 
-    for (int m = 0; m < model.meshCount; m++)
+    for (int i = 0; i < 4; i++)
     {
-        int tcounter = 0;
+        // Texture coordinates in cubes units, one texture tile per cube
+        float u = corners[i].x/cubeSize.x + 0.5f;
+        float w = corners[i].z/cubeSize.z + 0.5f;
+        float h = (cubeSize.y - corners[i].y)/cubeSize.y;
+        Vector2 texcoord = { 0 };
 
-        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        switch (face)
         {
-            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
-            // expecting they point to the counter-clockwise vertex triangle, so triangle indexes need to be reversed
-            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
-            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
-            tcounter += 3;
+            case CUBICMAP_FACE_TOP:
+            case CUBICMAP_FACE_ROOF: texcoord = (Vector2){ u, w }; break;
+            case CUBICMAP_FACE_BOTTOM:
+            case CUBICMAP_FACE_FLOOR: texcoord = (Vector2){ -u, w }; break;
+            case CUBICMAP_FACE_FRONT: texcoord = (Vector2){ u, h }; break;
+            case CUBICMAP_FACE_BACK: texcoord = (Vector2){ -u, h }; break;
+            case CUBICMAP_FACE_RIGHT: texcoord = (Vector2){ -w, h }; break;
+            case CUBICMAP_FACE_LEFT: texcoord = (Vector2){ w, h }; break;
+            default: break;
         }
+
+        mesh->vertices[(v + i)*3] = corners[i].x;
+        mesh->vertices[(v + i)*3 + 1] = corners[i].y;
+        mesh->vertices[(v + i)*3 + 2] = corners[i].z;
+        mesh->normals[(v + i)*3] = normal.x;
+        mesh->normals[(v + i)*3 + 1] = normal.y;
+        mesh->normals[(v + i)*3 + 2] = normal.z;
+        mesh->texcoords[(v + i)*2] = texcoord.x;
+        mesh->texcoords[(v + i)*2 + 1] = texcoord.y;
+    }
+
+    unsigned int *indices = &mesh->indices32[mesh->triangleCount*3];
+    indices[0] = v;
+    indices[1] = v + 1;
+    indices[2] = v + 2;
+    indices[3] = v;
+    indices[4] = v + 2;
+    indices[5] = v + 3;
+
+    mesh->vertexCount += 4;
+    mesh->triangleCount += 2;
+}
+#endif // SUPPORT_MESH_GENERATION
+
+// Load mesh triangles indices as 32bit, generated for non-indexed meshes
+static unsigned int *LoadMeshIndices(Mesh mesh)
+{
+    unsigned int *indices = (unsigned int *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned int));
+
+    for (int i = 0; i < mesh.triangleCount*3; i++)
+    {
+        if (mesh.indices32 != NULL) indices[i] = mesh.indices32[i];
+        else if (mesh.indices != NULL) indices[i] = mesh.indices[i];
+        else indices[i] = i;
     }
 
-    // Vertex arrays data processing
-    va = (IQMVertexArray *)RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
-    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
-    //fread(va, sizeof(IQMVertexArray), iqmHeader->num_vertexarrays, iqmFile);
-    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    return indices;
+}
 
-    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+// Weld vertices with same attributes, returns unique vertex count
+// NOTE: Unique vertices keep their input order, remap provides new index for every input vertex
+static int WeldMeshVertices(Mesh mesh, unsigned int *remap)
+{
+    // Vertex attributes compared, runtime animation data not considered
+    const unsigned char *attributes[8] = {
+        (const unsigned char *)mesh.vertices, (const unsigned char *)mesh.texcoords, (const unsigned char *)mesh.texcoords2,
+        (const unsigned char *)mesh.normals, (const unsigned char *)mesh.tangents, mesh.colors, mesh.boneIndices,
+        (const unsigned char *)mesh.boneWeights
+    };
+    const int sizes[8] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4, 4, 4*sizeof(float) };
+
+    // Hash table of unique vertices, open addressing
+    int tableSize = 1;
+    while (tableSize < mesh.vertexCount*2) tableSize *= 2;
+
+    unsigned int *table = (unsigned int *)RL_MALLOC(tableSize*sizeof(unsigned int));
+    memset(table, 0xff, tableSize*sizeof(unsigned int));
+
+    int uniqueCount = 0;
+
+    for (int v = 0; v < mesh.vertexCount; v++)
     {
-        switch (va[i].type)
+        // Vertex attributes hash (FNV-1a)
+        unsigned int hash = 2166136261u;
+        for (int a = 0; a < 8; a++)
         {
-            case IQM_POSITION:
+            if (attributes[a] == NULL) continue;
+
+            const unsigned char *bytes = attributes[a] + (size_t)v*sizes[a];
+            for (int b = 0; b < sizes[a]; b++) hash = (hash ^ bytes[b])*16777619u;
+        }
+
+        unsigned int slot = hash & (tableSize - 1);
+
+        while (table[slot] != 0xffffffff)
+        {
+            unsigned int other = table[slot];
+            bool equal = true;
+
+            for (int a = 0; (a < 8) && equal; a++)
             {
-                vertex = (float *)RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[a].offset, SEEK_SET);
-                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+                if ((attributes[a] != NULL) && (memcmp(attributes[a] + (size_t)v*sizes[a], attributes[a] + (size_t)other*sizes[a], sizes[a]) != 0)) equal = false;
+            }
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+            if (equal) break;
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (table[slot] == 0xffffffff)
+        {
+            table[slot] = v;
+            remap[v] = uniqueCount++;
+        }
+        else remap[v] = remap[table[slot]];
+    }
+
+    RL_FREE(table);
+
+    return uniqueCount;
+}
+
+// Remap mesh vertex attributes into new vertex order
+// NOTE: Vertices remapped to 0xffffffff are removed, vertices remapped to same index must be equal
+static void RemapMeshVertices(Mesh *mesh, const unsigned int *remap, int remapCount)
+{
+    mesh->vertices = (float *)RemapVertexAttribute(mesh->vertices, 3*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->texcoords = (float *)RemapVertexAttribute(mesh->texcoords, 2*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->texcoords2 = (float *)RemapVertexAttribute(mesh->texcoords2, 2*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->normals = (float *)RemapVertexAttribute(mesh->normals, 3*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->tangents = (float *)RemapVertexAttribute(mesh->tangents, 4*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->colors = (unsigned char *)RemapVertexAttribute(mesh->colors, 4, remap, mesh->vertexCount, remapCount);
+    mesh->boneIndices = (unsigned char *)RemapVertexAttribute(mesh->boneIndices, 4, remap, mesh->vertexCount, remapCount);
+    mesh->boneWeights = (float *)RemapVertexAttribute(mesh->boneWeights, 4*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->animVertices = (float *)RemapVertexAttribute(mesh->animVertices, 3*sizeof(float), remap, mesh->vertexCount, remapCount);
+    mesh->animNormals = (float *)RemapVertexAttribute(mesh->animNormals, 3*sizeof(float), remap, mesh->vertexCount, remapCount);
+
+    mesh->vertexCount = remapCount;
+}
+
+// Remap vertex attribute data, input data is freed
+static void *RemapVertexAttribute(void *data, int size, const unsigned int *remap, int vertexCount, int remapCount)
+{
+    if (data == NULL) return NULL;
+
+    unsigned char *result = (unsigned char *)RL_MALLOC((size_t)remapCount*size);
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        if (remap[i] != 0xffffffff) memcpy(result + (size_t)remap[i]*size, (unsigned char *)data + (size_t)i*size, size);
+    }
+
+    RL_FREE(data);
+
+    return result;
+}
+
+// Reorder triangles for post-transform vertex cache, returns clusters count
+// NOTE: Tipsify algorithm [Sander et al. 2007], fanning around vertices still in cache,
+// clusters start (first triangle) are provided on dead-ends, last one is triangleCount
+static int OptimizeVertexCache(unsigned int *indices, int triangleCount, int vertexCount, int *clusters)
+{
+    int indexCount = triangleCount*3;
+
+    // Vertex triangles adjacency, live triangles count per vertex
+    int *liveCount = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *adjacencyOffset = (int *)RL_CALLOC(vertexCount + 1, sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *cacheTime = (int *)RL_MALLOC(vertexCount*sizeof(int));
+
+    for (int i = 0; i < indexCount; i++) liveCount[indices[i]]++;
+    for (int v = 0; v < vertexCount; v++) adjacencyOffset[v + 1] = adjacencyOffset[v] + liveCount[v];
+
+    memcpy(cacheTime, adjacencyOffset, vertexCount*sizeof(int));
+    for (int i = 0; i < indexCount; i++) adjacency[cacheTime[indices[i]]++] = i/3;
+    memset(cacheTime, 0, vertexCount*sizeof(int));
+
+    bool *emitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    unsigned int *deadEnd = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    unsigned int *result = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    int deadEndCount = 0;
+    int resultCount = 0;
+    int clusterCount = 0;
+    int time = MESH_OPTIMIZE_CACHE_SIZE + 1;
+    int cursor = 0;
+    int fanning = -1;
+
+    while (resultCount < triangleCount)
+    {
+        // Dead-end, next vertex from dead-end stack or input order
+        if (fanning < 0)
+        {
+            while ((deadEndCount > 0) && (fanning < 0))
+            {
+                unsigned int v = deadEnd[--deadEndCount];
+                if (liveCount[v] > 0) fanning = v;
+            }
+
+            while ((cursor < vertexCount) && (fanning < 0))
+            {
+                if (liveCount[cursor] > 0) fanning = cursor;
+                else cursor++;
+            }
+
+            clusters[clusterCount++] = resultCount;
+        }
+
+        // Emit all fanning vertex triangles, candidates are pushed into dead-end stack
+        int candidates = deadEndCount;
+
+        for (int a = adjacencyOffset[fanning]; a < adjacencyOffset[fanning + 1]; a++)
+        {
+            int t = adjacency[a];
+            if (emitted[t]) continue;
+
+            for (int k = 0; k < 3; k++)
+            {
+                unsigned int v = indices[t*3 + k];
+
+                result[resultCount*3 + k] = v;
+                deadEnd[deadEndCount++] = v;
+                liveCount[v]--;
+
+                if ((time - cacheTime[v]) > MESH_OPTIMIZE_CACHE_SIZE) cacheTime[v] = time++;
+            }
+
+            emitted[t] = true;
+            resultCount++;
+        }
+
+        // Next fanning vertex, the oldest candidate remaining in cache after emitting its triangles
+        int bestPriority = -1;
+        fanning = -1;
+
+        for (int c = candidates; c < deadEndCount; c++)
+        {
+            unsigned int v = deadEnd[c];
+            if (liveCount[v] <= 0) continue;
+
+            int priority = 0;
+            if ((time - cacheTime[v] + 2*liveCount[v]) <= MESH_OPTIMIZE_CACHE_SIZE) priority = time - cacheTime[v];
+
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                fanning = v;
+            }
+        }
+    }
+
+    clusters[clusterCount] = triangleCount;
+    memcpy(indices, result, indexCount*sizeof(unsigned int));
+
+    RL_FREE(liveCount);
+    RL_FREE(adjacencyOffset);
+    RL_FREE(adjacency);
+    RL_FREE(cacheTime);
+    RL_FREE(emitted);
+    RL_FREE(deadEnd);
+    RL_FREE(result);
+
+    return clusterCount;
+}
+
+// Reorder triangle clusters to reduce overdraw
+// NOTE: Clusters facing outwards from mesh center are drawn first, they are more likely to occlude others
+static void OptimizeOverdraw(unsigned int *indices, const float *vertices, const int *clusters, int clusterCount)
+{
+    TriangleCluster *sorted = (TriangleCluster *)RL_MALLOC(clusterCount*sizeof(TriangleCluster));
+    Vector3 *centroids = (Vector3 *)RL_CALLOC(clusterCount, sizeof(Vector3));
+    Vector3 *normals = (Vector3 *)RL_CALLOC(clusterCount, sizeof(Vector3));
+
+    // Clusters area weighted centroid and normal
+    Vector3 meshCentroid = { 0 };
+    float meshArea = 0.0f;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        float clusterArea = 0.0f;
+
+        for (int t = clusters[c]; t < clusters[c + 1]; t++)
+        {
+            Vector3 v0 = { vertices[indices[t*3]*3], vertices[indices[t*3]*3 + 1], vertices[indices[t*3]*3 + 2] };
+            Vector3 v1 = { vertices[indices[t*3 + 1]*3], vertices[indices[t*3 + 1]*3 + 1], vertices[indices[t*3 + 1]*3 + 2] };
+            Vector3 v2 = { vertices[indices[t*3 + 2]*3], vertices[indices[t*3 + 2]*3 + 1], vertices[indices[t*3 + 2]*3 + 2] };
+
+            Vector3 normal = Vector3CrossProduct(Vector3Subtract(v1, v0), Vector3Subtract(v2, v0));
+            float area = Vector3Length(normal);
+
+            centroids[c] = Vector3Add(centroids[c], Vector3Scale(Vector3Add(Vector3Add(v0, v1), v2), area/3.0f));
+            normals[c] = Vector3Add(normals[c], normal);
+            clusterArea += area;
+        }
+
+        meshCentroid = Vector3Add(meshCentroid, centroids[c]);
+        meshArea += clusterArea;
+
+        if (clusterArea > 0.0f) centroids[c] = Vector3Scale(centroids[c], 1.0f/clusterArea);
+    }
+
+    if (meshArea > 0.0f) meshCentroid = Vector3Scale(meshCentroid, 1.0f/meshArea);
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        sorted[c].start = clusters[c];
+        sorted[c].count = clusters[c + 1] - clusters[c];
+        sorted[c].sortKey = Vector3DotProduct(Vector3Subtract(centroids[c], meshCentroid), Vector3Normalize(normals[c]));
+    }
+
+    qsort(sorted, clusterCount, sizeof(TriangleCluster), CompareTriangleClusters);
+
+    // Copy clusters triangles in sorted order
+    unsigned int *result = (unsigned int *)RL_MALLOC(clusters[clusterCount]*3*sizeof(unsigned int));
+
+    for (int c = 0, offset = 0; c < clusterCount; c++)
+    {
+        memcpy(result + offset*3, indices + sorted[c].start*3, sorted[c].count*3*sizeof(unsigned int));
+        offset += sorted[c].count;
+    }
+
+    memcpy(indices, result, clusters[clusterCount]*3*sizeof(unsigned int));
+
+    RL_FREE(result);
+    RL_FREE(sorted);
+    RL_FREE(centroids);
+    RL_FREE(normals);
+}
+
+// Compare triangle clusters sort key, used on overdraw optimization (descending order)
+static int CompareTriangleClusters(const void *a, const void *b)
+{
+    float keyA = ((const TriangleCluster *)a)->sortKey;
+    float keyB = ((const TriangleCluster *)b)->sortKey;
+
+    return (keyA < keyB) - (keyA > keyB);
+}
+
+// Set mesh indices from 32bit indices, 16bit indices used when possible (vertexCount <= 65535)
+// NOTE: Provided indices are owned by mesh (32bit) or freed
+static void SetMeshIndices(Mesh *mesh, unsigned int *indices, int triangleCount)
+{
+    RL_FREE(mesh->indices);
+    RL_FREE(mesh->indices32);
+    mesh->indices = NULL;
+    mesh->indices32 = NULL;
+    mesh->triangleCount = triangleCount;
+
+    if (mesh->vertexCount > 65535) mesh->indices32 = indices;
+    else
+    {
+        mesh->indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned short));
+        for (int i = 0; i < triangleCount*3; i++) mesh->indices[i] = (unsigned short)indices[i];
+        RL_FREE(indices);
+    }
+}
+
+// Load vertex attribute data copy
+static void *LoadVertexAttributeCopy(const void *data, int size, int vertexCount)
+{
+    if (data == NULL) return NULL;
+
+    void *result = RL_MALLOC((size_t)vertexCount*size);
+    memcpy(result, data, (size_t)vertexCount*size);
+
+    return result;
+}
+
+#if SUPPORT_MESH_GENERATION
+// Check vertex attribute equal for two vertices, also true if attribute is not available
+static bool IsVertexAttributeEqual(const void *data, int size, unsigned int a, unsigned int b)
+{
+    if (data == NULL) return true;
+
+    return (memcmp((const unsigned char *)data + (size_t)a*size, (const unsigned char *)data + (size_t)b*size, size) == 0);
+}
+
+// Simplify mesh triangles by edge collapses, returns triangles count
+// NOTE: Vertices are grouped by position, every collapse moves a group into a neighbor group (half-edge collapse),
+// group vertices (wedges) are remapped to target vertices sharing a collapsed triangle, keeping attributes seams
+static int SimplifyMesh(Mesh *mesh, unsigned int *indices, int triangleCount, int targetCount, float maxError)
+{
+    int vertexCount = mesh->vertexCount;
+    MeshSimplifier simplifier = { 0 };
+    simplifier.indices = indices;
+
+    // Group vertices at same position
+    Mesh positions = { 0 };
+    positions.vertexCount = vertexCount;
+    positions.vertices = mesh->vertices;
+
+    simplifier.groups = (unsigned int *)RL_MALLOC(vertexCount*sizeof(unsigned int));
+    simplifier.groupCount = WeldMeshVertices(positions, simplifier.groups);
+
+    int groupCount = simplifier.groupCount;
+
+    // Positions normalized to mesh size, error is relative to it
+    BoundingBox bounds = GetMeshBoundingBox(*mesh);
+    Vector3 size = Vector3Subtract(bounds.max, bounds.min);
+    float scale = fmaxf(size.x, fmaxf(size.y, size.z));
+    if (scale <= 0.0f) scale = 1.0f;
+
+    simplifier.positions = (Vector3 *)RL_MALLOC(groupCount*sizeof(Vector3));
+    for (int v = 0; v < vertexCount; v++)
+    {
+        Vector3 position = { mesh->vertices[v*3], mesh->vertices[v*3 + 1], mesh->vertices[v*3 + 2] };
+        simplifier.positions[simplifier.groups[v]] = Vector3Scale(Vector3Subtract(position, bounds.min), 1.0f/scale);
+    }
+
+    // Group vertices lists
+    simplifier.wedgeOffset = (int *)RL_CALLOC(groupCount + 1, sizeof(int));
+    simplifier.wedges = (unsigned int *)RL_MALLOC(vertexCount*sizeof(unsigned int));
+    int *wedgeFill = (int *)RL_MALLOC(groupCount*sizeof(int));
+
+    for (int v = 0; v < vertexCount; v++) simplifier.wedgeOffset[simplifier.groups[v] + 1]++;
+    for (int g = 0; g < groupCount; g++) simplifier.wedgeOffset[g + 1] += simplifier.wedgeOffset[g];
+    memcpy(wedgeFill, simplifier.wedgeOffset, groupCount*sizeof(int));
+    for (int v = 0; v < vertexCount; v++) simplifier.wedges[wedgeFill[simplifier.groups[v]]++] = v;
+
+    RL_FREE(wedgeFill);
+
+    // Merge group vertices with same attributes and close normals (averaged)
+    unsigned int *remap = (unsigned int *)RL_MALLOC(vertexCount*sizeof(unsigned int));
+    for (int v = 0; v < vertexCount; v++) remap[v] = v;
+
+    float seamCos = cosf(MESH_LOD_SEAM_ANGLE*DEG2RAD);
+
+    for (int g = 0; g < groupCount; g++)
+    {
+        int start = simplifier.wedgeOffset[g];
+        int count = 0;
+
+        for (int i = start; i < simplifier.wedgeOffset[g + 1]; i++)
+        {
+            unsigned int v = simplifier.wedges[i];
+
+            for (int j = start; j < (start + count); j++)
+            {
+                unsigned int w = simplifier.wedges[j];
+
+                if (IsVertexAttributeEqual(mesh->texcoords, 2*sizeof(float), v, w) &&
+                    IsVertexAttributeEqual(mesh->texcoords2, 2*sizeof(float), v, w) &&
+                    IsVertexAttributeEqual(mesh->colors, 4, v, w) &&
+                    IsVertexAttributeEqual(mesh->boneIndices, 4, v, w) &&
+                    IsVertexAttributeEqual(mesh->boneWeights, 4*sizeof(float), v, w))
+                {
+                    if (mesh->normals != NULL)
+                    {
+                        Vector3 normal = { mesh->normals[v*3], mesh->normals[v*3 + 1], mesh->normals[v*3 + 2] };
+                        Vector3 merged = { mesh->normals[w*3], mesh->normals[w*3 + 1], mesh->normals[w*3 + 2] };
+
+                        if (Vector3DotProduct(Vector3Normalize(normal), Vector3Normalize(merged)) < seamCos) continue;
+
+                        merged = Vector3Add(merged, normal);
+                        mesh->normals[w*3] = merged.x;
+                        mesh->normals[w*3 + 1] = merged.y;
+                        mesh->normals[w*3 + 2] = merged.z;
+                    }
+
+                    remap[v] = w;
+                    break;
+                }
+            }
+
+            if (remap[v] == v) simplifier.wedges[start + count++] = v;
+        }
+
+        for (int i = start + count; i < simplifier.wedgeOffset[g + 1]; i++) simplifier.wedges[i] = 0xffffffff;
+    }
+
+    if (mesh->normals != NULL)
+    {
+        for (int v = 0; v < vertexCount; v++)
+        {
+            if (remap[v] != (unsigned int)v) continue;
+
+            Vector3 normal = Vector3Normalize((Vector3){ mesh->normals[v*3], mesh->normals[v*3 + 1], mesh->normals[v*3 + 2] });
+            mesh->normals[v*3] = normal.x;
+            mesh->normals[v*3 + 1] = normal.y;
+            mesh->normals[v*3 + 2] = normal.z;
+        }
+    }
+
+    // Remap merged vertices, triangles degenerated by position are removed
+    int count = 0;
+    for (int t = 0; t < triangleCount; t++)
+    {
+        unsigned int v0 = remap[indices[t*3]];
+        unsigned int v1 = remap[indices[t*3 + 1]];
+        unsigned int v2 = remap[indices[t*3 + 2]];
+        unsigned int *groups = simplifier.groups;
+
+        if ((groups[v0] != groups[v1]) && (groups[v1] != groups[v2]) && (groups[v0] != groups[v2]))
+        {
+            indices[count*3] = v0;
+            indices[count*3 + 1] = v1;
+            indices[count*3 + 2] = v2;
+            count++;
+        }
+    }
+
+    triangleCount = count;
+    for (int v = 0; v < vertexCount; v++) remap[v] = v;
+
+    // Triangles quadrics, area weighted
+    simplifier.quadrics = (MeshQuadric *)RL_CALLOC(groupCount, sizeof(MeshQuadric));
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        unsigned int g0 = simplifier.groups[indices[t*3]];
+        unsigned int g1 = simplifier.groups[indices[t*3 + 1]];
+        unsigned int g2 = simplifier.groups[indices[t*3 + 2]];
+        Vector3 p0 = simplifier.positions[g0];
+
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(simplifier.positions[g1], p0), Vector3Subtract(simplifier.positions[g2], p0));
+        float area = Vector3Length(normal);
+
+        simplifier.area += area;
+
+        if (area > 0.0f)
+        {
+            normal = Vector3Scale(normal, 1.0f/area);
+            float distance = -Vector3DotProduct(normal, p0);
+
+            AddQuadricPlane(&simplifier.quadrics[g0], normal, distance, area);
+            AddQuadricPlane(&simplifier.quadrics[g1], normal, distance, area);
+            AddQuadricPlane(&simplifier.quadrics[g2], normal, distance, area);
+        }
+    }
+
+    // Simplification passes, cheapest independent collapses applied every pass
+    simplifier.triangles = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
+    simplifier.triangleOffset = (int *)RL_MALLOC((groupCount + 1)*sizeof(int));
+    simplifier.openEdges = (unsigned int *)RL_MALLOC(groupCount*2*sizeof(unsigned int));
+    simplifier.openCount = (int *)RL_MALLOC(groupCount*sizeof(int));
+    simplifier.edgeOpen = (bool *)RL_MALLOC(triangleCount*3*sizeof(bool));
+
+    EdgeCollapse *collapses = (EdgeCollapse *)RL_MALLOC(triangleCount*3*sizeof(EdgeCollapse));
+    bool *locked = (bool *)RL_MALLOC(groupCount*sizeof(bool));
+    float maxErrorSqr = maxError*maxError;
+    bool edgeQuadrics = true;
+    simplifier.minArea = simplifier.area*(1.0f - MESH_LOD_MAX_AREA_LOSS);
+
+    while (triangleCount > targetCount)
+    {
+        simplifier.triangleCount = triangleCount;
+        UpdateMeshSimplifier(&simplifier, edgeQuadrics);
+        edgeQuadrics = false;
+
+        // Collapse candidates, cheapest valid direction of every edge
+        int collapseCount = 0;
+
+        for (int i = 0; i < triangleCount*3; i++)
+        {
+            unsigned int a = simplifier.groups[indices[i]];
+            unsigned int b = simplifier.groups[indices[((i%3) == 2)? (i - 2) : (i + 1)]];
+
+            // Manifold edges are shared by two triangles in opposite directions, considered once
+            if ((a > b) && !simplifier.edgeOpen[i]) continue;
+
+            float errorAB = GetCollapseError(&simplifier, a, b, NULL, NULL, NULL);
+            float errorBA = GetCollapseError(&simplifier, b, a, NULL, NULL, NULL);
+
+            EdgeCollapse collapse = { a, b, errorAB };
+            if ((errorBA >= 0.0f) && ((errorAB < 0.0f) || (errorBA < errorAB))) collapse = (EdgeCollapse){ b, a, errorBA };
+
+            if ((collapse.error >= 0.0f) && (collapse.error <= maxErrorSqr)) collapses[collapseCount++] = collapse;
+        }
+
+        if (collapseCount == 0) break;
+
+        qsort(collapses, collapseCount, sizeof(EdgeCollapse), CompareEdgeCollapses);
+
+        // Apply collapses, groups involved are locked for current pass
+        memset(locked, 0, groupCount*sizeof(bool));
+
+        int removed = 0;
+        int applied = 0;
+
+        for (int c = 0; (c < collapseCount) && ((triangleCount - removed) > targetCount); c++)
+        {
+            unsigned int a = collapses[c].group;
+            unsigned int b = collapses[c].target;
+            int collapsed = 0;
+            float lostArea = 0.0f;
+
+            if (locked[a] || locked[b]) continue;
+            if (GetCollapseError(&simplifier, a, b, remap, &collapsed, &lostArea) < 0.0f) continue;
+
+            simplifier.area -= lostArea;
+
+            simplifier.quadrics[b] = AddQuadrics(simplifier.quadrics[a], simplifier.quadrics[b]);
+
+            // Groups sharing a triangle with collapsed group are locked, their triangles validity changed
+            for (int i = simplifier.triangleOffset[a]; i < simplifier.triangleOffset[a + 1]; i++)
+            {
+                for (int k = 0; k < 3; k++) locked[simplifier.groups[indices[simplifier.triangles[i]*3 + k]]] = true;
+            }
+
+            removed += collapsed;
+            applied++;
+        }
+
+        if (applied == 0) break;
+
+        // Remap collapsed vertices, collapsed triangles are removed
+        count = 0;
+        for (int t = 0; t < triangleCount; t++)
+        {
+            unsigned int v0 = remap[indices[t*3]];
+            unsigned int v1 = remap[indices[t*3 + 1]];
+            unsigned int v2 = remap[indices[t*3 + 2]];
+            unsigned int *groups = simplifier.groups;
+
+            if ((groups[v0] != groups[v1]) && (groups[v1] != groups[v2]) && (groups[v0] != groups[v2]))
+            {
+                indices[count*3] = v0;
+                indices[count*3 + 1] = v1;
+                indices[count*3 + 2] = v2;
+                count++;
+            }
+        }
+
+        triangleCount = count;
+        for (int v = 0; v < vertexCount; v++) remap[v] = v;
+    }
+
+    RL_FREE(remap);
+    RL_FREE(collapses);
+    RL_FREE(locked);
+    RL_FREE(simplifier.groups);
+    RL_FREE(simplifier.wedges);
+    RL_FREE(simplifier.wedgeOffset);
+    RL_FREE(simplifier.positions);
+    RL_FREE(simplifier.quadrics);
+    RL_FREE(simplifier.triangles);
+    RL_FREE(simplifier.triangleOffset);
+    RL_FREE(simplifier.openEdges);
+    RL_FREE(simplifier.openCount);
+    RL_FREE(simplifier.edgeOpen);
+
+    return triangleCount;
+}
+
+// Update mesh simplifier adjacency and open edges from current triangles
+// NOTE: Open edges are used by a single triangle considering vertices (not positions): borders and attributes seams,
+// optionally, planes perpendicular to open edges are added to groups quadrics to keep their shape
+static void UpdateMeshSimplifier(MeshSimplifier *simplifier, bool edgeQuadrics)
+{
+    int indexCount = simplifier->triangleCount*3;
+    unsigned int *indices = simplifier->indices;
+
+    // Group triangles adjacency
+    memset(simplifier->triangleOffset, 0, (simplifier->groupCount + 1)*sizeof(int));
+    for (int i = 0; i < indexCount; i++) simplifier->triangleOffset[simplifier->groups[indices[i]] + 1]++;
+    for (int g = 0; g < simplifier->groupCount; g++) simplifier->triangleOffset[g + 1] += simplifier->triangleOffset[g];
+
+    int *fill = (int *)RL_MALLOC(simplifier->groupCount*sizeof(int));
+    memcpy(fill, simplifier->triangleOffset, simplifier->groupCount*sizeof(int));
+    for (int i = 0; i < indexCount; i++) simplifier->triangles[fill[simplifier->groups[indices[i]]]++] = i/3;
+    RL_FREE(fill);
+
+    // Count triangles using every vertex edge, hash table with open addressing
+    unsigned int tableSize = 1;
+    while (tableSize < (unsigned int)indexCount*2) tableSize *= 2;
+
+    unsigned long long *keys = (unsigned long long *)RL_MALLOC(tableSize*sizeof(unsigned long long));
+    unsigned int *slots = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    int *counts = (int *)RL_CALLOC(tableSize, sizeof(int));
+    memset(keys, 0xff, tableSize*sizeof(unsigned long long));
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        unsigned int u = indices[i];
+        unsigned int v = indices[((i%3) == 2)? (i - 2) : (i + 1)];
+        unsigned long long key = (u < v)? (((unsigned long long)u << 32) | v) : (((unsigned long long)v << 32) | u);
+        unsigned int slot = (unsigned int)((key*0x9E3779B97F4A7C15ull) >> 32) & (tableSize - 1);
+
+        while ((keys[slot] != key) && (keys[slot] != 0xffffffffffffffffull)) slot = (slot + 1) & (tableSize - 1);
+
+        keys[slot] = key;
+        counts[slot]++;
+        slots[i] = slot;
+    }
+
+    // Group neighbors through open edges
+    memset(simplifier->openCount, 0, simplifier->groupCount*sizeof(int));
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        simplifier->edgeOpen[i] = (counts[slots[i]] == 1);
+        if (!simplifier->edgeOpen[i]) continue;
+
+        unsigned int ga = simplifier->groups[indices[i]];
+        unsigned int gb = simplifier->groups[indices[((i%3) == 2)? (i - 2) : (i + 1)]];
+
+        for (int k = 0; k < 2; k++)
+        {
+            unsigned int g = (k == 0)? ga : gb;
+            unsigned int other = (k == 0)? gb : ga;
+            int *openCount = &simplifier->openCount[g];
+
+            if ((*openCount == 0) || ((*openCount == 1) && (simplifier->openEdges[g*2] != other))) simplifier->openEdges[g*2 + (*openCount)++] = other;
+            else if ((*openCount == 2) && (simplifier->openEdges[g*2] != other) && (simplifier->openEdges[g*2 + 1] != other)) *openCount = 3;
+        }
+
+        if (edgeQuadrics)
+        {
+            int t = i/3;
+            Vector3 p0 = simplifier->positions[simplifier->groups[indices[t*3]]];
+            Vector3 p1 = simplifier->positions[simplifier->groups[indices[t*3 + 1]]];
+            Vector3 p2 = simplifier->positions[simplifier->groups[indices[t*3 + 2]]];
+            Vector3 normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0)));
+
+            Vector3 pa = simplifier->positions[ga];
+            Vector3 edge = Vector3Subtract(simplifier->positions[gb], pa);
+            Vector3 planeNormal = Vector3Normalize(Vector3CrossProduct(edge, normal));
+            float weight = Vector3DotProduct(edge, edge)*MESH_LOD_BORDER_WEIGHT;
+
+            AddQuadricPlane(&simplifier->quadrics[ga], planeNormal, -Vector3DotProduct(planeNormal, pa), weight);
+            AddQuadricPlane(&simplifier->quadrics[gb], planeNormal, -Vector3DotProduct(planeNormal, pa), weight);
+        }
+    }
+
+    RL_FREE(keys);
+    RL_FREE(slots);
+    RL_FREE(counts);
+}
+
+// Get edge collapse error (moving group into target group), -1.0f if collapse is not valid
+// NOTE: Optionally, group vertices remap to target vertices, number of collapsed triangles and lost area are provided
+static float GetCollapseError(const MeshSimplifier *simplifier, unsigned int group, unsigned int target, unsigned int *remap, int *collapsed, float *lostArea)
+{
+    // Groups with open edges (borders or seams) only collapse along them, more than two open neighbors locks the group
+    int openCount = simplifier->openCount[group];
+    if (openCount > 2) return -1.0f;
+    if ((openCount > 0) && (simplifier->openEdges[group*2] != target) && ((openCount < 2) || (simplifier->openEdges[group*2 + 1] != target))) return -1.0f;
+
+    unsigned int wedges[MESH_LOD_MAX_WEDGES] = { 0 };
+    unsigned int targets[MESH_LOD_MAX_WEDGES] = { 0 };
+    bool used[MESH_LOD_MAX_WEDGES] = { 0 };
+    int wedgeCount = 0;
+
+    for (int i = simplifier->wedgeOffset[group]; (i < simplifier->wedgeOffset[group + 1]) && (simplifier->wedges[i] != 0xffffffff); i++)
+    {
+        if (wedgeCount == MESH_LOD_MAX_WEDGES) return -1.0f;
+
+        wedges[wedgeCount] = simplifier->wedges[i];
+        targets[wedgeCount] = 0xffffffff;
+        wedgeCount++;
+    }
+
+    Vector3 position = simplifier->positions[group];
+    Vector3 targetPosition = simplifier->positions[target];
+    float area = 0.0f;
+    float movedArea = 0.0f;
+    int count = 0;
+
+    for (int i = simplifier->triangleOffset[group]; i < simplifier->triangleOffset[group + 1]; i++)
+    {
+        const unsigned int *triangle = &simplifier->indices[simplifier->triangles[i]*3];
+        int k = (simplifier->groups[triangle[0]] == group)? 0 : ((simplifier->groups[triangle[1]] == group)? 1 : 2);
+        unsigned int v1 = triangle[(k + 1)%3];
+        unsigned int v2 = triangle[(k + 2)%3];
+
+        int w = 0;
+        while ((w < wedgeCount) && (wedges[w] != triangle[k])) w++;
+        if (w == wedgeCount) return -1.0f;
+        used[w] = true;
+
+        unsigned int targetVertex = (simplifier->groups[v1] == target)? v1 : ((simplifier->groups[v2] == target)? v2 : 0xffffffff);
+
+        if (targetVertex != 0xffffffff)
+        {
+            // Triangle collapsed, group vertex must collapse into a single target vertex
+            if (targets[w] == 0xffffffff) targets[w] = targetVertex;
+            else if (targets[w] != targetVertex) return -1.0f;
+
+            Vector3 p1 = simplifier->positions[simplifier->groups[v1]];
+            Vector3 p2 = simplifier->positions[simplifier->groups[v2]];
+            area += Vector3Length(Vector3CrossProduct(Vector3Subtract(p1, position), Vector3Subtract(p2, position)));
+            count++;
+        }
+        else
+        {
+            // Triangle moved, it must not flip or fold (normal rotated more than MESH_LOD_FLIP_ANGLE)
+            Vector3 p1 = simplifier->positions[simplifier->groups[v1]];
+            Vector3 p2 = simplifier->positions[simplifier->groups[v2]];
+            Vector3 normal = Vector3CrossProduct(Vector3Subtract(p1, position), Vector3Subtract(p2, position));
+            Vector3 movedNormal = Vector3CrossProduct(Vector3Subtract(p1, targetPosition), Vector3Subtract(p2, targetPosition));
+
+            if (Vector3DotProduct(normal, movedNormal) <= cosf(MESH_LOD_FLIP_ANGLE*DEG2RAD)*Vector3Length(normal)*Vector3Length(movedNormal)) return -1.0f;
+
+            area += Vector3Length(normal);
+            movedArea += Vector3Length(movedNormal);
+        }
+    }
+
+    // Surface area lost by all collapses is limited, avoiding shrinking the mesh into slivers
+    if ((simplifier->area - (area - movedArea)) < simplifier->minArea) return -1.0f;
+
+    // Every used group vertex requires a target vertex, collapsing along attributes seams
+    for (int w = 0; w < wedgeCount; w++) if (used[w] && (targets[w] == 0xffffffff)) return -1.0f;
+
+    float error = GetQuadricError(AddQuadrics(simplifier->quadrics[group], simplifier->quadrics[target]), targetPosition);
+
+    if (remap != NULL) for (int w = 0; w < wedgeCount; w++) if (used[w]) remap[wedges[w]] = targets[w];
+    if (collapsed != NULL) *collapsed = count;
+    if (lostArea != NULL) *lostArea = area - movedArea;
+
+    return error;
+}
+
+// Add plane to quadric, weighted
+static void AddQuadricPlane(MeshQuadric *quadric, Vector3 normal, float distance, float weight)
+{
+    quadric->a00 += weight*normal.x*normal.x;
+    quadric->a11 += weight*normal.y*normal.y;
+    quadric->a22 += weight*normal.z*normal.z;
+    quadric->a10 += weight*normal.y*normal.x;
+    quadric->a20 += weight*normal.z*normal.x;
+    quadric->a21 += weight*normal.z*normal.y;
+    quadric->b0 += weight*normal.x*distance;
+    quadric->b1 += weight*normal.y*distance;
+    quadric->b2 += weight*normal.z*distance;
+    quadric->c += weight*distance*distance;
+    quadric->weight += weight;
+}
+
+// Add two quadrics
+static MeshQuadric AddQuadrics(MeshQuadric q1, MeshQuadric q2)
+{
+    MeshQuadric result = {
+        q1.a00 + q2.a00, q1.a11 + q2.a11, q1.a22 + q2.a22,
+        q1.a10 + q2.a10, q1.a20 + q2.a20, q1.a21 + q2.a21,
+        q1.b0 + q2.b0, q1.b1 + q2.b1, q1.b2 + q2.b2,
+        q1.c + q2.c, q1.weight + q2.weight
+    };
+
+    return result;
+}
+
+// Get quadric error at position, squared distance to planes normalized by weight
+static float GetQuadricError(MeshQuadric quadric, Vector3 position)
+{
+    float x = position.x;
+    float y = position.y;
+    float z = position.z;
+
+    float error = quadric.a00*x*x + quadric.a11*y*y + quadric.a22*z*z +
+        2.0f*(quadric.a10*x*y + quadric.a20*x*z + quadric.a21*y*z) +
+        2.0f*(quadric.b0*x + quadric.b1*y + quadric.b2*z) + quadric.c;
+
+    return (quadric.weight > 0.0f)? fabsf(error)/quadric.weight : 0.0f;
+}
+
+// Compare edge collapses error, used on mesh simplification (ascending order)
+static int CompareEdgeCollapses(const void *a, const void *b)
+{
+    float errorA = ((const EdgeCollapse *)a)->error;
+    float errorB = ((const EdgeCollapse *)b)->error;
+
+    return (errorA > errorB) - (errorA < errorB);
+}
+
+#endif // SUPPORT_MESH_GENERATION
+
+// Get model level of detail to draw, considering current transform and projection
+// NOTE: Bounding sphere (from meshes cached bounds) screen size, ratio of screen height,
+// a single mesh bounds are considered if mesh index is provided (-1 for all model meshes)
+static int GetModelLOD(Model model, int meshIndex)
+{
+    int lod = 0;
+
+    if ((model.lodCount > 0) && (model.meshCount > 0))
+    {
+        BoundingBox bounds = model.meshes[(meshIndex >= 0)? meshIndex : 0].bounds;
+        if ((meshIndex < 0) && (model.instanceCount > 0)) bounds = GetBoundingBoxTransformed(model.meshes[model.instanceMeshes[0]].bounds, model.instanceTransforms[0]);
+
+        for (int i = 1; (i < model.meshCount) && (meshIndex < 0) && (model.instanceCount == 0); i++)
+        {
+            bounds.min = Vector3Min(bounds.min, model.meshes[i].bounds.min);
+            bounds.max = Vector3Max(bounds.max, model.meshes[i].bounds.max);
+        }
+
+        for (int i = 1; (i < model.instanceCount) && (meshIndex < 0); i++)
+        {
+            BoundingBox instanceBounds = GetBoundingBoxTransformed(model.meshes[model.instanceMeshes[i]].bounds, model.instanceTransforms[i]);
+            bounds.min = Vector3Min(bounds.min, instanceBounds.min);
+            bounds.max = Vector3Max(bounds.max, instanceBounds.max);
+        }
+
+        Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+        float radius = Vector3Distance(bounds.max, center);
+
+        // Bounding sphere in view space, radius scaled by maximum axis scale
+        Matrix matModelView = MatrixMultiply(MatrixMultiply(model.transform, rlGetMatrixTransform()), rlGetMatrixModelview());
+        center = Vector3Transform(center, matModelView);
+
+        float scaleX = matModelView.m0*matModelView.m0 + matModelView.m1*matModelView.m1 + matModelView.m2*matModelView.m2;
+        float scaleY = matModelView.m4*matModelView.m4 + matModelView.m5*matModelView.m5 + matModelView.m6*matModelView.m6;
+        float scaleZ = matModelView.m8*matModelView.m8 + matModelView.m9*matModelView.m9 + matModelView.m10*matModelView.m10;
+        radius *= sqrtf(fmaxf(scaleX, fmaxf(scaleY, scaleZ)));
+
+        // Screen size, perspective projection divided by depth (maximum detail if camera is inside)
+        Matrix matProjection = rlGetMatrixProjection();
+        float size = radius*matProjection.m5;
+
+        if (matProjection.m15 == 0.0f)
+        {
+            float depth = -center.z;
+            size = (depth > radius)? size/depth : 1.0f;
+        }
+
+        while ((lod < model.lodCount) && (size < model.lodScreenSizes[lod])) lod++;
+    }
+
+    return lod;
+}
+
+// Update model current pose, interpolated animation frame
+// NOTE: Request frame could be fractional, using a lerp interpolation between two frames
+static void UpdateModelAnimationPose(Model model, ModelAnimation anim, float frame)
+{
+    // Get frame and blending from frame factor required
+    int currentFrame = (int)frame;
+    int nextFrame = currentFrame + 1;
+    float blend = frame - currentFrame;
+    blend = Clamp(blend, 0.0f, 1.0f);
+    if (currentFrame >= anim.keyframeCount) currentFrame = currentFrame%anim.keyframeCount;
+    if (nextFrame >= anim.keyframeCount) nextFrame = nextFrame%anim.keyframeCount;
+
+    for (unsigned int boneIndex = 0; boneIndex < model.skeleton.boneCount; boneIndex++)
+    {
+        model.currentPose[boneIndex] = GetAnimationBonePose(anim, boneIndex, currentFrame, nextFrame, blend);
+    }
+}
+
+// Get animation bone pose interpolated between two frames
+// NOTE: Compressed animations are sampled directly at fractional frame when frames are consecutive
+static Transform GetAnimationBonePose(ModelAnimation anim, int boneIndex, int currentFrame, int nextFrame, float blend)
+{
+    Transform result = { 0 };
+
+    if (anim.clip != NULL)
+    {
+        if (nextFrame == (currentFrame + 1))
+        {
+            float frame = (float)currentFrame + blend;
+            Vector4 translation = GetAnimationTrackValue(anim.clip, boneIndex*3, frame);
+            Vector4 scale = GetAnimationTrackValue(anim.clip, boneIndex*3 + 2, frame);
+
+            result.translation = (Vector3){ translation.x, translation.y, translation.z };
+            result.rotation = GetAnimationTrackValue(anim.clip, boneIndex*3 + 1, frame);
+            result.scale = (Vector3){ scale.x, scale.y, scale.z };
+        }
+        else
+        {
+            // Frames wrap around, interpolate between both frames poses
+            Transform current = GetAnimationBonePose(anim, boneIndex, currentFrame, currentFrame + 1, 0.0f);
+            Transform next = GetAnimationBonePose(anim, boneIndex, nextFrame, nextFrame + 1, 0.0f);
+
+            result.translation = Vector3Lerp(current.translation, next.translation, blend);
+            result.rotation = QuaternionSlerp(current.rotation, next.rotation, blend);
+            result.scale = Vector3Lerp(current.scale, next.scale, blend);
+        }
+    }
+    else
+    {
+        const Transform *current = &anim.keyframePoses[currentFrame][boneIndex];
+        const Transform *next = &anim.keyframePoses[nextFrame][boneIndex];
+
+        result.translation = Vector3Lerp(current->translation, next->translation, blend);
+        result.rotation = QuaternionSlerp(current->rotation, next->rotation, blend);
+        result.scale = Vector3Lerp(current->scale, next->scale, blend);
+    }
+
+    return result;
+}
+
+// Get animation clip track value at fractional frame, keys linearly interpolated
+// NOTE: Track index is bone*3 + [0: translation, 1: rotation, 2: scale], vector tracks return w = 0
+static Vector4 GetAnimationTrackValue(const rAnimationClip *clip, int trackIndex, float frame)
+{
+    const AnimationTrack *track = &clip->tracks[trackIndex];
+    const unsigned short *keyFrames = clip->keyFrames + track->keyOffset;
+    bool rotation = ((trackIndex%3) == 1);
+
+    // Find track keys around frame (binary search)
+    int low = 0;
+    int high = track->keyCount - 1;
+
+    if (frame <= (float)keyFrames[0]) high = 0;
+    else if (frame >= (float)keyFrames[high]) low = high;
+    else
+    {
+        while ((high - low) > 1)
+        {
+            int mid = (low + high)/2;
+            if ((float)keyFrames[mid] <= frame) low = mid;
+            else high = mid;
+        }
+    }
+
+    Vector4 result = GetAnimationTrackKey(clip, track, low, rotation);
+
+    if (high != low)
+    {
+        Vector4 next = GetAnimationTrackKey(clip, track, high, rotation);
+        float amount = (frame - (float)keyFrames[low])/(float)(keyFrames[high] - keyFrames[low]);
+
+        if (rotation)
+        {
+            // Quaternions could be in opposite hemispheres after quantization
+            if ((result.x*next.x + result.y*next.y + result.z*next.z + result.w*next.w) < 0.0f) next = QuaternionScale(next, -1.0f);
+            result = QuaternionNlerp(result, next, amount);
+        }
+        else result = (Vector4){ result.x + amount*(next.x - result.x), result.y + amount*(next.y - result.y), result.z + amount*(next.z - result.z), 0.0f };
+    }
+
+    return result;
+}
+
+// Get animation clip track key value, dequantized
+static Vector4 GetAnimationTrackKey(const rAnimationClip *clip, const AnimationTrack *track, int key, bool rotation)
+{
+    const unsigned short *value = clip->keyValues + (track->keyOffset + key)*3;
+    Vector4 result = { 0 };
+
+    if (rotation) result = DecodeQuaternion(value);
+    else
+    {
+        result.x = track->offset[0] + track->range[0]*(float)value[0]/65535.0f;
+        result.y = track->offset[1] + track->range[1]*(float)value[1]/65535.0f;
+        result.z = track->offset[2] + track->range[2]*(float)value[2]/65535.0f;
+    }
+
+    return result;
+}
+
+// Encode quaternion into 48 bits, smallest three components encoding
+// NOTE: Largest component is dropped (recomputed on decoding) and its index stored in components spare bits,
+// other three components are in range [-1/sqrt(2), 1/sqrt(2)] and quantized to 15 bits
+static void EncodeQuaternion(Quaternion q, unsigned short *result)
+{
+    float values[4] = { q.x, q.y, q.z, q.w };
+    int largest = 0;
+
+    for (int i = 1; i < 4; i++) if (fabsf(values[i]) > fabsf(values[largest])) largest = i;
+
+    float sign = (values[largest] < 0.0f)? -1.0f : 1.0f;
+
+    for (int i = 0, k = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+
+        float value = Clamp(values[i]*sign*0.70710678f + 0.5f, 0.0f, 1.0f);
+        result[k] = (unsigned short)(value*32767.0f + 0.5f);
+        k++;
+    }
+
+    result[0] |= (unsigned short)((largest & 1) << 15);
+    result[1] |= (unsigned short)((largest >> 1) << 15);
+}
+
+// Decode quaternion from 48 bits, smallest three components encoding
+static Quaternion DecodeQuaternion(const unsigned short *value)
+{
+    int largest = (value[0] >> 15) | ((value[1] >> 15) << 1);
+    float values[4] = { 0 };
+    float sum = 0.0f;
+
+    for (int i = 0, k = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+
+        values[i] = ((float)(value[k] & 0x7fff)/32767.0f - 0.5f)*1.41421356f;
+        sum += values[i]*values[i];
+        k++;
+    }
+
+    values[largest] = sqrtf(fmaxf(1.0f - sum, 0.0f));
+
+    Quaternion result = { values[0], values[1], values[2], values[3] };
+
+    return result;
+}
+
+// Update model bone matrices from current pose
+// NOTE: Skeleton cached inverse bind matrices are used when available
+static void UpdateModelBoneMatrices(Model model)
+{
+    for (unsigned int boneIndex = 0; boneIndex < model.skeleton.boneCount; boneIndex++)
+    {
+        Matrix invBindMatrix = { 0 };
+
+        if (model.skeleton.invBindMatrices != NULL) invBindMatrix = model.skeleton.invBindMatrices[boneIndex];
+        else invBindMatrix = MatrixInvert(GetTransformMatrix(model.skeleton.bindPose[boneIndex]));
+
+        model.boneMatrices[boneIndex] = MatrixMultiply(invBindMatrix, GetTransformMatrix(model.currentPose[boneIndex]));
+    }
+}
+
+// Add animation clip track key
+static void AddAnimationTrackKey(rAnimationClip *clip, AnimationTrack *track, int frame, const unsigned short *value)
+{
+    clip->keyFrames[clip->keyCount] = (unsigned short)frame;
+    memcpy(&clip->keyValues[clip->keyCount*3], value, 3*sizeof(unsigned short));
+    clip->keyCount++;
+    track->keyCount++;
+}
+
+// Check track frames interpolated from keys are within error
+// NOTE: Keys are quantized values at start and end frames, constant segments only use start key
+static bool IsAnimationSegmentValid(const Vector4 *values, const Vector4 *decoded, int start, int end, bool rotation, float maxError, bool constant)
+{
+    bool result = true;
+
+    for (int f = start; f <= end; f++)
+    {
+        float amount = constant? 0.0f : (float)(f - start)/(float)(end - start);
+        Vector4 value = { 0 };
+
+        if (rotation)
+        {
+            value = QuaternionNlerp(decoded[start], decoded[end], amount);
+
+            float dot = fminf(fabsf(Vector4DotProduct(value, values[f])), 1.0f);
+            if (2.0f*acosf(dot) > maxError) { result = false; break; }
+        }
+        else
+        {
+            value.x = decoded[start].x + amount*(decoded[end].x - decoded[start].x);
+            value.y = decoded[start].y + amount*(decoded[end].y - decoded[start].y);
+            value.z = decoded[start].z + amount*(decoded[end].z - decoded[start].z);
+
+            if ((fabsf(value.x - values[f].x) > maxError) ||
+                (fabsf(value.y - values[f].y) > maxError) ||
+                (fabsf(value.z - values[f].z) > maxError)) { result = false; break; }
+        }
+    }
+
+    return result;
+}
+
+// Get transform matrix: scale, rotation and translation
+// NOTE: Same result as MatrixMultiply(MatrixMultiply(MatrixScale(), QuaternionToMatrix()), MatrixTranslate())
+static Matrix GetTransformMatrix(Transform transform)
+{
+    Matrix result = QuaternionToMatrix(transform.rotation);
+
+    result.m0 *= transform.scale.x;
+    result.m1 *= transform.scale.x;
+    result.m2 *= transform.scale.x;
+    result.m4 *= transform.scale.y;
+    result.m5 *= transform.scale.y;
+    result.m6 *= transform.scale.y;
+    result.m8 *= transform.scale.z;
+    result.m9 *= transform.scale.z;
+    result.m10 *= transform.scale.z;
+    result.m12 = transform.translation.x;
+    result.m13 = transform.translation.y;
+    result.m14 = transform.translation.z;
+
+    return result;
+}
+
+// Load bones skinning matrices for CPU skinning (28 floats per bone)
+// NOTE: Matrices are stored by columns, normals use the inverse transpose of bone matrix 3x3 part,
+// computed with columns cross products (inverse rows), translation does not affect normals
+static float *LoadSkinningMatrices(const Matrix *boneMatrices, int boneCount)
+{
+    float *skinMatrices = (float *)RL_MALLOC(boneCount*28*sizeof(float));
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        Matrix mat = boneMatrices[i];
+
+        Vector3 col0 = { mat.m0, mat.m1, mat.m2 };
+        Vector3 col1 = { mat.m4, mat.m5, mat.m6 };
+        Vector3 col2 = { mat.m8, mat.m9, mat.m10 };
+
+        Vector3 normal0 = Vector3CrossProduct(col1, col2);
+        Vector3 normal1 = Vector3CrossProduct(col2, col0);
+        Vector3 normal2 = Vector3CrossProduct(col0, col1);
+        float det = Vector3DotProduct(col0, normal0);
+        float invDet = (det != 0.0f)? 1.0f/det : 0.0f;
+
+        const float columns[28] = {
+            col0.x, col0.y, col0.z, 0.0f,
+            col1.x, col1.y, col1.z, 0.0f,
+            col2.x, col2.y, col2.z, 0.0f,
+            mat.m12, mat.m13, mat.m14, 0.0f,
+            normal0.x*invDet, normal0.y*invDet, normal0.z*invDet, 0.0f,
+            normal1.x*invDet, normal1.y*invDet, normal1.z*invDet, 0.0f,
+            normal2.x*invDet, normal2.y*invDet, normal2.z*invDet, 0.0f
+        };
+
+        memcpy(skinMatrices + i*28, columns, 28*sizeof(float));
+    }
+
+    return skinMatrices;
+}
+
+// Skin meshes vertices into meshes animated buffers (animVertices, animNormals), CPU skinning
+// NOTE: Vertices of all meshes are split in ranges skinned in parallel, so threads are started once per call
+// and only if total vertices are enough, updated flags (one per mesh) are set for bone influenced meshes
+static void SkinMeshes(const Mesh *meshes, int meshCount, const float *skinMatrices, int boneCount, bool *updated)
+{
+    SkinningTask tasks[MAX_MODELS_THREADS] = { 0 };
+    int vertexCount = 0;
+    int taskCount = 1;
+
+    for (int m = 0; m < meshCount; m++) vertexCount += meshes[m].vertexCount;
+
+#if SUPPORT_MODELS_THREADING
+    taskCount = vertexCount/SKINNING_THREAD_MIN_VERTICES;
+    if (taskCount > MAX_MODELS_THREADS) taskCount = MAX_MODELS_THREADS;
+    if (taskCount < 1) taskCount = 1;
+#endif
+    // NOTE: Every task sets its own updated flags, merged once all tasks are done
+    bool *taskUpdated = (taskCount > 1)? (bool *)RL_CALLOC(taskCount*meshCount, sizeof(bool)) : updated;
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        tasks[t].meshes = meshes;
+        tasks[t].meshCount = meshCount;
+        tasks[t].skinMatrices = skinMatrices;
+        tasks[t].boneCount = boneCount;
+        tasks[t].start = (int)((long long)vertexCount*t/taskCount);
+        tasks[t].end = (int)((long long)vertexCount*(t + 1)/taskCount);
+        tasks[t].updated = taskUpdated + t*meshCount;
+    }
+
+#if SUPPORT_MODELS_THREADING
+    if (taskCount > 1)
+    {
+        RunParallelTasks(SkinMeshVertices, tasks, taskCount, sizeof(SkinningTask));
+
+        for (int t = 0; t < taskCount; t++)
+        {
+            for (int m = 0; m < meshCount; m++) updated[m] |= taskUpdated[t*meshCount + m];
+        }
+
+        RL_FREE(taskUpdated);
+    }
+    else SkinMeshVertices(&tasks[0]);
+#else
+    SkinMeshVertices(&tasks[0]);
+#endif
+}
+
+// Skin meshes vertices range (SkinningTask), CPU skinning
+// NOTE: Up to 4 bones skinning matrices are blended by weight first, then vertex position and normal are
+// transformed once, same result as blending every bone transformed vertex but with less operations
+static void SkinMeshVertices(void *data)
+{
+    SkinningTask *task = (SkinningTask *)data;
+
+    for (int m = 0, offset = 0; (m < task->meshCount) && (offset < task->end); offset += task->meshes[m].vertexCount, m++)
+    {
+        const Mesh *mesh = &task->meshes[m];
+        bool skinNormals = (mesh->normals != NULL);
+        int start = (task->start > offset)? (task->start - offset) : 0;
+        int end = ((task->end - offset) < mesh->vertexCount)? (task->end - offset) : mesh->vertexCount;
+
+        for (int v = start; v < end; v++)
+        {
+            const unsigned char *boneIndices = &mesh->boneIndices[v*4];
+            const float *boneWeights = &mesh->boneWeights[v*4];
+            const float *vertex = &mesh->vertices[v*3];
+            float result[4] = { 0 };
+
+#if defined(RMODELS_SSE_ENABLED)
+            __m128 col[7] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+
+            // Blend bones skinning matrices by weight
+            for (int j = 0; j < 4; j++)
+            {
+                // Early stop when no transformation will be applied
+                if (boneWeights[j] == 0.0f) continue;
+                task->updated[m] = true;
+                if (boneIndices[j] >= task->boneCount) continue;
+
+                const float *skin = task->skinMatrices + boneIndices[j]*28;
+                __m128 weight = _mm_set1_ps(boneWeights[j]);
+                int columnCount = skinNormals? 7 : 4;
+
+                for (int k = 0; k < columnCount; k++) col[k] = _mm_add_ps(col[k], _mm_mul_ps(weight, _mm_loadu_ps(skin + k*4)));
+            }
+
+            __m128 position = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col[0], _mm_set1_ps(vertex[0])), _mm_mul_ps(col[1], _mm_set1_ps(vertex[1]))),
+                                         _mm_add_ps(_mm_mul_ps(col[2], _mm_set1_ps(vertex[2])), col[3]));
+            _mm_storeu_ps(result, position);
+            memcpy(&mesh->animVertices[v*3], result, 3*sizeof(float));
+
+            // Normals processing
+            // NOTE: Using mesh.normals (default normal) to calculate mesh.animNormals (animated normals)
+            if (skinNormals)
+            {
+                const float *normal = &mesh->normals[v*3];
+                __m128 animNormal = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col[4], _mm_set1_ps(normal[0])), _mm_mul_ps(col[5], _mm_set1_ps(normal[1]))),
+                                               _mm_mul_ps(col[6], _mm_set1_ps(normal[2])));
+                _mm_storeu_ps(result, animNormal);
+                memcpy(&mesh->animNormals[v*3], result, 3*sizeof(float));
+            }
+#else
+            float col[28] = { 0 };
+
+            // Blend bones skinning matrices by weight
+            for (int j = 0; j < 4; j++)
+            {
+                // Early stop when no transformation will be applied
+                if (boneWeights[j] == 0.0f) continue;
+                task->updated[m] = true;
+                if (boneIndices[j] >= task->boneCount) continue;
+
+                const float *skin = task->skinMatrices + boneIndices[j]*28;
+                float weight = boneWeights[j];
+                int valueCount = skinNormals? 28 : 16;
+
+                for (int k = 0; k < valueCount; k++) col[k] += weight*skin[k];
+            }
+
+            for (int k = 0; k < 3; k++) result[k] = col[k]*vertex[0] + col[4 + k]*vertex[1] + col[8 + k]*vertex[2] + col[12 + k];
+            memcpy(&mesh->animVertices[v*3], result, 3*sizeof(float));
+
+            // Normals processing
+            // NOTE: Using mesh.normals (default normal) to calculate mesh.animNormals (animated normals)
+            if (skinNormals)
+            {
+                const float *normal = &mesh->normals[v*3];
+
+                for (int k = 0; k < 3; k++) result[k] = col[16 + k]*normal[0] + col[20 + k]*normal[1] + col[24 + k]*normal[2];
+                memcpy(&mesh->animNormals[v*3], result, 3*sizeof(float));
+            }
+#endif
+        }
+    }
+}
+
+#if SUPPORT_FILEFORMAT_IQM || SUPPORT_FILEFORMAT_GLTF
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Skipping bone not topologically sorted: Bone %d has parent %d", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+            transforms[i].translation = Vector3Multiply(transforms[i].translation, transforms[bones[i].parent].scale);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+        }
+    }
+}
+#endif
+
+#if SUPPORT_FILEFORMAT_OBJ
+// Count OBJ text chunk attributes (ParseTaskOBJ), lines checked same way as parseLine()
+static void CountChunkOBJ(void *data)
+{
+    ParseTaskOBJ *task = (ParseTaskOBJ *)data;
+    const char *text = task->text;
+    const char *end = task->text + task->length;
+
+    while (text < end)
+    {
+        const char *line = text;
+        while ((text < end) && (*text != '\n') && (*text != '\r')) text++;
+        int length = (int)(text - line);
+        text++;
+
+        if (length > 4095) continue;    // Line ignored by parseLine()
+        while ((length > 0) && IS_SPACE(*line)) { line++; length--; }
+
+        if ((length < 2) || (line[0] != 'v')) continue;
+
+        if (IS_SPACE(line[1])) task->counts[0]++;
+        else if ((length > 2) && (line[1] == 't') && IS_SPACE(line[2])) task->counts[1]++;
+        else if ((length > 2) && (line[1] == 'n') && IS_SPACE(line[2])) task->counts[2]++;
+    }
+}
+
+// Parse OBJ text chunk (ParseTaskOBJ), attributes written after chunk bases and triangles stored per chunk
+// NOTE: Chunk bases are known (counted before), so relative indices are resolved while parsing
+static void ParseChunkOBJ(void *data)
+{
+    ParseTaskOBJ *task = (ParseTaskOBJ *)data;
+    const char *text = task->text;
+    const char *end = task->text + task->length;
+
+    Command command = { 0 };
+    int counts[3] = { 0 };
+    int cornerCapacity = 0;
+    int breakCapacity = 0;
+
+    while (text < end)
+    {
+        const char *line = text;
+        while ((text < end) && (*text != '\n') && (*text != '\r')) text++;
+        unsigned int length = (unsigned int)(text - line);
+        text++;
+
+        if (!parseLine(&command, line, length, 1)) continue;
+
+        switch (command.type)
+        {
+            case COMMAND_V:
+            {
+                if (counts[0] < task->counts[0])
+                {
+                    float *position = task->positions + (task->bases[0] + counts[0])*3;
+                    position[0] = command.vx;
+                    position[1] = command.vy;
+                    position[2] = command.vz;
+                }
+                counts[0]++;
+            } break;
+            case COMMAND_VT:
+            {
+                if (counts[1] < task->counts[1])
+                {
+                    float *texcoord = task->texcoords + (task->bases[1] + counts[1])*2;
+                    texcoord[0] = command.tx;
+                    texcoord[1] = command.ty;
+                }
+                counts[1]++;
+            } break;
+            case COMMAND_VN:
+            {
+                if (counts[2] < task->counts[2])
+                {
+                    float *normal = task->normals + (task->bases[2] + counts[2])*3;
+                    normal[0] = command.nx;
+                    normal[1] = command.ny;
+                    normal[2] = command.nz;
+                }
+                counts[2]++;
+            } break;
+            case COMMAND_F:
+            {
+                // Face already triangulated by parseLine(), 3 corners per triangle
+                int cornerCount = task->triangleCount*3;
+
+                if ((cornerCount + (int)command.num_f) > cornerCapacity)
+                {
+                    cornerCapacity = (cornerCapacity > 0)? cornerCapacity*2 : 3072;
+                    task->corners = (tinyobj_vertex_index_t *)RL_REALLOC(task->corners, cornerCapacity*sizeof(tinyobj_vertex_index_t));
+                }
+
+                for (unsigned int k = 0; k < command.num_f; k++)
+                {
+                    tinyobj_vertex_index_t *corner = &task->corners[cornerCount + k];
+                    corner->v_idx = fixIndex(command.f[k].v_idx, task->bases[0] + counts[0]);
+                    corner->vt_idx = fixIndex(command.f[k].vt_idx, task->bases[1] + counts[1]);
+                    corner->vn_idx = fixIndex(command.f[k].vn_idx, task->bases[2] + counts[2]);
+                }
+
+                task->triangleCount += (int)command.num_f/3;
+            } break;
+            case COMMAND_USEMTL:
+            case COMMAND_G:
+            case COMMAND_O:
+            {
+                if (task->breakCount == breakCapacity)
+                {
+                    breakCapacity = (breakCapacity > 0)? breakCapacity*2 : 64;
+                    task->breaks = (MeshBreakOBJ *)RL_REALLOC(task->breaks, breakCapacity*sizeof(MeshBreakOBJ));
+                }
+
+                MeshBreakOBJ *meshBreak = &task->breaks[task->breakCount];
+                meshBreak->triangle = task->triangleCount;
+                meshBreak->material = (command.type == COMMAND_USEMTL)? command.material_name : NULL;
+                meshBreak->materialLength = (command.type == COMMAND_USEMTL)? (int)command.material_name_len : 0;
+                task->breakCount++;
+            } break;
+            case COMMAND_MTLLIB:
+            {
+                task->mtllib = command.mtllib_name;
+                task->mtllibLength = (int)command.mtllib_name_len;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Fill OBJ meshes triangles range (FillTaskOBJ), meshes are not indexed (3 vertices per triangle)
+static void FillMeshesOBJ(void *data)
+{
+    FillTaskOBJ *task = (FillTaskOBJ *)data;
+    const float *positions = task->chunks[0].positions;
+    const float *texcoords = task->chunks[0].texcoords;
+    const float *normals = task->chunks[0].normals;
+
+    int chunk = 0;
+    int meshIndex = 0;
+
+    for (int t = task->first; t < task->last; t++)
+    {
+        while (t >= (task->chunks[chunk].triangleBase + task->chunks[chunk].triangleCount)) chunk++;
+        while (t >= task->meshTriangles[meshIndex + 1]) meshIndex++;
+
+        const tinyobj_vertex_index_t *corners = task->chunks[chunk].corners + (t - task->chunks[chunk].triangleBase)*3;
+        Mesh *mesh = &task->meshes[meshIndex];
+        int vertex = (t - task->meshTriangles[meshIndex])*3;
+
+        for (int k = 0; k < 3; k++, vertex++)
+        {
+            int v = corners[k].v_idx;
+            int vt = corners[k].vt_idx;
+            int vn = corners[k].vn_idx;
+
+            if ((v >= 0) && (v < task->counts[0])) memcpy(&mesh->vertices[vertex*3], &positions[v*3], 3*sizeof(float));
+
+            if ((mesh->texcoords != NULL) && (vt >= 0) && (vt < task->counts[1]))
+            {
+                mesh->texcoords[vertex*2] = texcoords[vt*2];
+                mesh->texcoords[vertex*2 + 1] = 1.0f - texcoords[vt*2 + 1];
+            }
+
+            if ((vn >= 0) && (vn < task->counts[2])) memcpy(&mesh->normals[vertex*3], &normals[vn*3], 3*sizeof(float));
+            else
+            {
+                mesh->normals[vertex*3] = 0.0f;
+                mesh->normals[vertex*3 + 1] = 1.0f;
+                mesh->normals[vertex*3 + 2] = 0.0f;
+            }
+
+            if (mesh->colors != NULL) memset(&mesh->colors[vertex*4], 255, 4);
+        }
+    }
+}
+
+// Load OBJ mesh data
+// Notes to keep in mind:
+//  - File text is split in chunks of whole lines, parsed in parallel (lines parsed by tinyobj)
+//  - A mesh is created for every shape (o, g) and material (usemtl) change, if it contains faces
+//  - Faces are triangulated, meshes are not indexed
+//  - Materials library and textures paths are relative to OBJ file directory, working directory is not changed
+static Model LoadOBJ(const char *fileName)
+{
+    Model model = { 0 };
+    model.transform = MatrixIdentity();
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText == NULL)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Unable to read obj file", fileName);
+        return model;
+    }
+
+    int textLength = (int)strlen(fileText);
+
+    char directory[MAX_FILEPATH_LENGTH] = { 0 };
+    snprintf(directory, MAX_FILEPATH_LENGTH, "%s", GetDirectoryPath(fileName));
+
+    // Split file text in chunks of whole lines, one chunk per task
+    ParseTaskOBJ tasks[MAX_MODELS_THREADS] = { 0 };
+    int taskCount = 1;
+
+#if SUPPORT_MODELS_THREADING
+    taskCount = textLength/OBJ_THREAD_MIN_SIZE;
+    if (taskCount > MAX_MODELS_THREADS) taskCount = MAX_MODELS_THREADS;
+    if (taskCount < 1) taskCount = 1;
+#endif
+
+    for (int t = 0, start = 0; t < taskCount; t++)
+    {
+        int end = (int)((long long)textLength*(t + 1)/taskCount);
+        if (end < start) end = start;
+        while ((end > 0) && (end < textLength) && (fileText[end - 1] != '\n') && (fileText[end - 1] != '\r')) end++;
+
+        tasks[t].text = fileText + start;
+        tasks[t].length = end - start;
+        start = end;
+    }
+
+    // Count attributes per chunk, required to place chunks attributes and resolve indices
+#if SUPPORT_MODELS_THREADING
+    if (taskCount > 1) RunParallelTasks(CountChunkOBJ, tasks, taskCount, sizeof(ParseTaskOBJ));
+    else CountChunkOBJ(&tasks[0]);
+#else
+    CountChunkOBJ(&tasks[0]);
+#endif
+
+    int counts[3] = { 0 };
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            tasks[t].bases[k] = counts[k];
+            counts[k] += tasks[t].counts[k];
+        }
+    }
+
+    float *positions = (float *)RL_MALLOC(counts[0]*3*sizeof(float));
+    float *texcoords = (float *)RL_MALLOC(counts[1]*2*sizeof(float));
+    float *normals = (float *)RL_MALLOC(counts[2]*3*sizeof(float));
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        tasks[t].positions = positions;
+        tasks[t].texcoords = texcoords;
+        tasks[t].normals = normals;
+    }
+
+    // Parse chunks: attributes and triangles
+#if SUPPORT_MODELS_THREADING
+    if (taskCount > 1) RunParallelTasks(ParseChunkOBJ, tasks, taskCount, sizeof(ParseTaskOBJ));
+    else ParseChunkOBJ(&tasks[0]);
+#else
+    ParseChunkOBJ(&tasks[0]);
+#endif
+
+    // Load materials library (last mtllib defined), relative to OBJ file directory
+    tinyobj_material_t *objMaterials = NULL;
+    unsigned int objMaterialCount = 0;
+    hash_table_t materialTable = { 0 };
+    create_hash_table(HASH_TABLE_DEFAULT_SIZE, &materialTable);
+
+    for (int t = taskCount - 1; t >= 0; t--)
+    {
+        if (tasks[t].mtllib == NULL) continue;
+
+        const char *mtllib = tasks[t].mtllib;
+        int length = tasks[t].mtllibLength;
+        while ((length > 0) && ((mtllib[length - 1] == '\0') || (mtllib[length - 1] == '\n') || (mtllib[length - 1] == '\r') || IS_SPACE(mtllib[length - 1]))) length--;
+
+        char mtlPath[MAX_FILEPATH_LENGTH] = { 0 };
+        GetFilePathOBJ(mtlPath, directory, mtllib, length);
+
+        int result = tinyobj_parse_and_index_mtl_file(&objMaterials, &objMaterialCount, mtlPath, &materialTable);
+        if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to parse materials file", mtlPath);
+        break;
+    }
+
+    // Split meshes on shape and material changes, same material meshes are not merged
+    int triangleCount = 0;
+    int breakCount = 0;
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        tasks[t].triangleBase = triangleCount;
+        triangleCount += tasks[t].triangleCount;
+        breakCount += tasks[t].breakCount;
+    }
+
+    int *meshTriangles = (int *)RL_MALLOC((breakCount + 2)*sizeof(int));
+    int *meshMaterialIds = (int *)RL_MALLOC((breakCount + 1)*sizeof(int));
+    int meshCount = 1;
+    int materialId = -1;        // Default unknown material
+    char materialName[4096] = { 0 };
+
+    meshTriangles[0] = 0;
+    meshMaterialIds[0] = materialId;
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        for (int b = 0; b < tasks[t].breakCount; b++)
+        {
+            const MeshBreakOBJ *meshBreak = &tasks[t].breaks[b];
+            int triangle = tasks[t].triangleBase + meshBreak->triangle;
+
+            if (meshBreak->material != NULL)
+            {
+                if (meshBreak->materialLength <= 0) continue;
+
+                memcpy(materialName, meshBreak->material, meshBreak->materialLength);
+                materialName[meshBreak->materialLength] = '\0';
+
+                int id = hash_table_exists(materialName, &materialTable)? (int)hash_table_get(materialName, &materialTable) : -1;
+                if (id == materialId) continue;
+                materialId = id;
+            }
+
+            if (triangle > meshTriangles[meshCount - 1])
+            {
+                meshTriangles[meshCount] = triangle;
+                meshCount++;
+            }
+
+            meshMaterialIds[meshCount - 1] = materialId;
+        }
+    }
+
+    // Last mesh could be empty (break after last face)
+    if ((meshCount > 1) && (meshTriangles[meshCount - 1] == triangleCount)) meshCount--;
+    meshTriangles[meshCount] = triangleCount;
+
+    // Allocate the base meshes and materials
+    model.meshCount = meshCount;
+    model.meshes = (Mesh *)MemAlloc(sizeof(Mesh)*model.meshCount);
+    model.meshMaterial = (int *)MemAlloc(sizeof(int)*model.meshCount);
+
+    if (objMaterialCount > 0)
+    {
+        model.materialCount = objMaterialCount;
+        model.materials = (Material *)MemAlloc(sizeof(Material)*objMaterialCount);
+    }
+    else // Allocate at least one material
+    {
+        model.materialCount = 1;
+        model.materials = (Material *)MemAlloc(sizeof(Material)*1);
+    }
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        int vertexCount = (meshTriangles[i + 1] - meshTriangles[i])*3;
+
+        model.meshes[i].vertexCount = vertexCount;
+        model.meshes[i].triangleCount = vertexCount/3;
+
+        model.meshes[i].vertices = (float *)MemAlloc(sizeof(float)*vertexCount*3);
+        model.meshes[i].normals = (float *)MemAlloc(sizeof(float)*vertexCount*3);
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        model.meshes[i].texcoords = (float *)MemAlloc(sizeof(float)*vertexCount*2);
+        model.meshes[i].colors = (unsigned char *)MemAlloc(sizeof(unsigned char)*vertexCount*4);
+    #else
+        if (counts[1] > 0) model.meshes[i].texcoords = (float *)MemAlloc(sizeof(float)*vertexCount*2);
+        else model.meshes[i].texcoords = NULL;
+        model.meshes[i].colors = NULL;
+    #endif
+
+        int matId = 0;
+        if ((meshMaterialIds[i] >= 0) && (meshMaterialIds[i] < (int)objMaterialCount)) matId = meshMaterialIds[i];
+
+        model.meshMaterial[i] = matId;
+    }
+
+    // Fill meshes, model triangles split between tasks
+    FillTaskOBJ fillTasks[MAX_MODELS_THREADS] = { 0 };
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        fillTasks[t].chunks = tasks;
+        fillTasks[t].meshes = model.meshes;
+        fillTasks[t].meshTriangles = meshTriangles;
+        for (int k = 0; k < 3; k++) fillTasks[t].counts[k] = counts[k];
+        fillTasks[t].first = (int)((long long)triangleCount*t/taskCount);
+        fillTasks[t].last = (int)((long long)triangleCount*(t + 1)/taskCount);
+    }
+
+#if SUPPORT_MODELS_THREADING
+    if (taskCount > 1) RunParallelTasks(FillMeshesOBJ, fillTasks, taskCount, sizeof(FillTaskOBJ));
+    else FillMeshesOBJ(&fillTasks[0]);
+#else
+    FillMeshesOBJ(&fillTasks[0]);
+#endif
+
+    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount, directory);
+    else model.materials[0] = LoadMaterialDefault(); // Set default material for the mesh
+
+    for (int t = 0; t < taskCount; t++)
+    {
+        RL_FREE(tasks[t].corners);
+        RL_FREE(tasks[t].breaks);
+    }
+
+    RL_FREE(positions);
+    RL_FREE(texcoords);
+    RL_FREE(normals);
+    RL_FREE(meshTriangles);
+    RL_FREE(meshMaterialIds);
+    destroy_hash_table(&materialTable);
+    tinyobj_materials_free(objMaterials, objMaterialCount);
+    UnloadFileText(fileText);
+
+    return model;
+}
+#endif
+
+#if SUPPORT_FILEFORMAT_IQM
+// Load IQM mesh data
+static Model LoadIQM(const char *fileName)
+{
+    #define IQM_MAGIC        "INTERQUAKEMODEL"  // IQM file magic number
+    #define IQM_VERSION              2          // Only IQM version 2 supported
+
+    #define BONE_NAME_LENGTH        32          // BoneInfo name string length
+    #define MESH_NAME_LENGTH        32          // Mesh name string length
+    #define MATERIAL_NAME_LENGTH    32          // Material name string length
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileDataPtr = fileData;
+
+    // IQM file structs
+    //-----------------------------------------------------------------------------------
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int dataSize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
+
+    typedef struct IQMMesh {
+        unsigned int name;
+        unsigned int material;
+        unsigned int first_vertex, num_vertexes;
+        unsigned int first_triangle, num_triangles;
+    } IQMMesh;
+
+    typedef struct IQMTriangle {
+        unsigned int vertex[3];
+    } IQMTriangle;
+
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
+
+    typedef struct IQMVertexArray {
+        unsigned int type;
+        unsigned int flags;
+        unsigned int format;
+        unsigned int size;
+        unsigned int offset;
+    } IQMVertexArray;
+
+    // NOTE: Below IQM structures are not used but listed for reference
+    /*
+    typedef struct IQMAdjacency {
+        unsigned int triangle[3];
+    } IQMAdjacency;
+
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
+
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
+
+    typedef struct IQMBounds {
+        float bbmin[3], bbmax[3];
+        float xyradius, radius;
+    } IQMBounds;
+    */
+    //-----------------------------------------------------------------------------------
+
+    // IQM vertex data types
+    enum {
+        IQM_POSITION     = 0,
+        IQM_TEXCOORD     = 1,
+        IQM_NORMAL       = 2,
+        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
+        IQM_BLENDINDEXES = 4,
+        IQM_BLENDWEIGHTS = 5,
+        IQM_COLOR        = 6,
+        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
+    };
+
+    Model model = { 0 };
+
+    IQMMesh *imesh = NULL;
+    IQMTriangle *tri = NULL;
+    IQMVertexArray *va = NULL;
+    IQMJoint *ijoint = NULL;
+
+    float *vertex = NULL;
+    float *normal = NULL;
+    float *text = NULL;
+    char *blendi = NULL;
+    unsigned char *blendw = NULL;
+    unsigned char *color = NULL;
+
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return model;
+
+    const char *basePath = GetDirectoryPath(fileName);
+
+    // Read IQM header
+    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileData(fileData);
+        return model;
+    }
+
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileData(fileData);
+        return model;
+    }
+
+    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+
+    // Meshes data processing
+    imesh = (IQMMesh *)RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
+    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
+    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
+    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+
+    model.meshCount = iqmHeader->num_meshes;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+    model.materialCount = model.meshCount;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    char name[MESH_NAME_LENGTH] = { 0 };
+    char material[MATERIAL_NAME_LENGTH] = { 0 };
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[a].name, SEEK_SET);
+        //fread(name, sizeof(char), MESH_NAME_LENGTH, iqmFile);
+        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[a].material, SEEK_SET);
+        //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
+        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+
+        model.materials[i] = LoadMaterialDefault();
+        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(TextFormat("%s/%s", basePath, material));
+
+        model.meshMaterial[i] = i;
+
+        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+
+        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+
+        model.meshes[i].vertices = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
+        model.meshes[i].normals = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
+        model.meshes[i].texcoords = (float *)RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+
+        model.meshes[i].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
+        model.meshes[i].boneWeights = (float *)RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+
+        model.meshes[i].triangleCount = imesh[i].num_triangles;
+
+        // NOTE: 32bit indices only used if mesh vertices can not be indexed with 16bit
+        if (model.meshes[i].vertexCount > 65535) model.meshes[i].indices32 = (unsigned int *)RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned int));
+        else model.meshes[i].indices = (unsigned short *)RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+
+#if !SUPPORT_GPU_SKINNING
+        // Animated vertex data, processed for rendering
+        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
+        model.meshes[i].animVertices = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+        model.meshes[i].animNormals = (float *)RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+#endif
+    }
+
+    // Triangles data processing
+    tri = (IQMTriangle *)RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
+    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
+    //fread(tri, sizeof(IQMTriangle), iqmHeader->num_triangles, iqmFile);
+    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        int tcounter = 0;
+
+        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        {
+            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
+            // expecting they point to the counter-clockwise vertex triangle, so triangle indexes need to be reversed
+            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
+            if (model.meshes[m].indices32 != NULL)
+            {
+                model.meshes[m].indices32[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
+                model.meshes[m].indices32[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
+                model.meshes[m].indices32[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
+            }
+            else
+            {
+                model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
+                model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
+                model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
+            }
+            tcounter += 3;
+        }
+    }
+
+    // Vertex arrays data processing
+    va = (IQMVertexArray *)RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
+    //fread(va, sizeof(IQMVertexArray), iqmHeader->num_vertexarrays, iqmFile);
+    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+
+    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+    {
+        switch (va[i].type)
+        {
+            case IQM_POSITION:
+            {
+                vertex = (float *)RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[a].offset, SEEK_SET);
+                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].vertices[vCounter] = vertex[i];
+                        if (model.meshes[m].animVertices != NULL) model.meshes[m].animVertices[vCounter] = vertex[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_NORMAL:
+            {
+                normal = (float *)RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[a].offset, SEEK_SET);
+                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].normals[vCounter] = normal[i];
+                        if (model.meshes[m].animNormals != NULL) model.meshes[m].animNormals[vCounter] = normal[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_TEXCOORD:
+            {
+                text = (float *)RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
+                //fseek(iqmFile, va[a].offset, SEEK_SET);
+                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
+                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
+                    {
+                        model.meshes[m].texcoords[vCounter] = text[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDINDEXES:
+            {
+                blendi = (char *)RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
+                //fseek(iqmFile, va[a].offset, SEEK_SET);
+                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
+                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneIndices[boneCounter] = blendi[i];
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDWEIGHTS:
+            {
+                blendw = (unsigned char *)RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[a].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_COLOR:
+            {
+                color = (unsigned char *)RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[a].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
+                    model.meshes[m].colors = (unsigned char *)RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
+
                     int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
                     {
-                        model.meshes[m].vertices[vCounter] = vertex[i];
-                        if (model.meshes[m].animVertices != NULL) model.meshes[m].animVertices[vCounter] = vertex[i];
+                        model.meshes[m].colors[vCounter] = color[i];
                         vCounter++;
                     }
                 }
-            } break;
-            case IQM_NORMAL:
-            {
-                normal = (float *)RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[a].offset, SEEK_SET);
-                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+            } break;
+        }
+    }
+
+    // Bones (joints) data processing
+    ijoint = (IQMJoint *)RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
+    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
+    //fread(ijoint, sizeof(IQMJoint), iqmHeader->num_joints, iqmFile);
+    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+
+    model.skeleton.boneCount = iqmHeader->num_joints;
+    model.skeleton.bones = (BoneInfo *)RL_CALLOC(iqmHeader->num_joints, sizeof(BoneInfo));
+    model.skeleton.bindPose = (Transform *)RL_CALLOC(iqmHeader->num_joints, sizeof(Transform));
+
+    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
+    {
+        // Bones
+        model.skeleton.bones[i].parent = ijoint[i].parent;
+        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[a].name, SEEK_SET);
+        //fread(model.bones[a].name, sizeof(char), BONE_NAME_LENGTH, iqmFile);
+        memcpy(model.skeleton.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
+
+        // Bind pose (base pose)
+        model.skeleton.bindPose[i].translation.x = ijoint[i].translate[0];
+        model.skeleton.bindPose[i].translation.y = ijoint[i].translate[1];
+        model.skeleton.bindPose[i].translation.z = ijoint[i].translate[2];
+
+        model.skeleton.bindPose[i].rotation.x = ijoint[i].rotate[0];
+        model.skeleton.bindPose[i].rotation.y = ijoint[i].rotate[1];
+        model.skeleton.bindPose[i].rotation.z = ijoint[i].rotate[2];
+        model.skeleton.bindPose[i].rotation.w = ijoint[i].rotate[3];
+
+        model.skeleton.bindPose[i].scale.x = ijoint[i].scale[0];
+        model.skeleton.bindPose[i].scale.y = ijoint[i].scale[1];
+        model.skeleton.bindPose[i].scale.z = ijoint[i].scale[2];
+    }
+
+    BuildPoseFromParentJoints(model.skeleton.bones, model.skeleton.boneCount, model.skeleton.bindPose);
+
+    // Initialize runtime animation data: current pose and bone matrices
+    model.currentPose = (Transform *)RL_CALLOC(model.skeleton.boneCount, sizeof(Transform));
+    model.boneMatrices = (Matrix *)RL_CALLOC(model.skeleton.boneCount, sizeof(Matrix));
+    for (unsigned int j = 0; j < model.skeleton.boneCount; j++) model.boneMatrices[j] = MatrixIdentity();
+
+    UnloadFileData(fileData);
+
+    RL_FREE(imesh);
+    RL_FREE(tri);
+    RL_FREE(va);
+    RL_FREE(vertex);
+    RL_FREE(normal);
+    RL_FREE(text);
+    RL_FREE(blendi);
+    RL_FREE(blendw);
+    RL_FREE(ijoint);
+    RL_FREE(color);
+
+    return model;
+}
+
+// Load IQM animation data
+static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCount)
+{
+    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
+    #define IQM_VERSION     2                   // only IQM version 2 supported
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileDataPtr = fileData;
+
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int dataSize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
+
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
+
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
+
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
+
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return NULL;
+
+    // Read IQM header
+    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileData(fileData);
+        return NULL;
+    }
+
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileData(fileData);
+        return NULL;
+    }
+
+    // Get bones data
+    IQMPose *poses = (IQMPose *)RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
+    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
+    //fread(poses, sizeof(IQMPose), iqmHeader->num_poses, iqmFile);
+    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
+
+    // Get animations data
+    *animCount = iqmHeader->num_anims;
+    IQMAnim *anim = (IQMAnim *)RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
+    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
+    //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
+    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
+
+    ModelAnimation *animations = (ModelAnimation *)RL_CALLOC(iqmHeader->num_anims, sizeof(ModelAnimation));
+
+    // frameposes
+    unsigned short *framedata = (unsigned short *)RL_CALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels, sizeof(unsigned short));
+    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
+    //fread(framedata, sizeof(unsigned short), iqmHeader->num_frames*iqmHeader->num_framechannels, iqmFile);
+    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+
+    // joints
+    IQMJoint *joints = (IQMJoint *)RL_CALLOC(iqmHeader->num_joints, sizeof(IQMJoint));
+    memcpy(joints, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+
+    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    {
+        animations[a].boneCount = iqmHeader->num_poses;
+        BoneInfo *bones = (BoneInfo *)RL_CALLOC(iqmHeader->num_poses, sizeof(BoneInfo));
+
+        animations[a].keyframeCount = anim[a].num_frames;
+        animations[a].keyframePoses = (Transform **)RL_CALLOC(anim[a].num_frames, sizeof(Transform *));
+        memcpy(animations[a].name, fileDataPtr + iqmHeader->ofs_text + anim[a].name, 32);
+        // TODO: Use animation framerate data?
+        //animations[a].framerate = anim.framerate;
+
+        TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s | Frames: %d | Framerate: %f", fileName, animations[a].name, animations[a].keyframeCount, anim[a].framerate);
+
+        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        {
+            bones[j].parent = poses[j].parent;
+
+            // NOTE: No need to store bones names, bones only required to generate keyframe poses
+            //if (iqmHeader->num_joints > 0) memcpy(bones[j].name, fileDataPtr + iqmHeader->ofs_text + joints[j].name, BONE_NAME_LENGTH*sizeof(char));
+            //else memcpy(bones[j].name, "ANIMJOINTNAME", 13); // Default bone name otherwise
+        }
+
+        for (unsigned int j = 0; j < anim[a].num_frames; j++)
+            animations[a].keyframePoses[j] = (Transform *)RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
+
+        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
+
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
+            {
+                animations[a].keyframePoses[frame][i].translation.x = poses[i].channeloffset[0];
+
+                if (poses[i].mask & 0x01)
+                {
+                    animations[a].keyframePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
+                    dcounter++;
+                }
+
+                animations[a].keyframePoses[frame][i].translation.y = poses[i].channeloffset[1];
+
+                if (poses[i].mask & 0x02)
+                {
+                    animations[a].keyframePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
+                    dcounter++;
+                }
+
+                animations[a].keyframePoses[frame][i].translation.z = poses[i].channeloffset[2];
+
+                if (poses[i].mask & 0x04)
+                {
+                    animations[a].keyframePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
+                    dcounter++;
+                }
+
+                animations[a].keyframePoses[frame][i].rotation.x = poses[i].channeloffset[3];
+
+                if (poses[i].mask & 0x08)
+                {
+                    animations[a].keyframePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
+                    dcounter++;
+                }
+
+                animations[a].keyframePoses[frame][i].rotation.y = poses[i].channeloffset[4];
+
+                if (poses[i].mask & 0x10)
+                {
+                    animations[a].keyframePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
+                    dcounter++;
+                }
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                animations[a].keyframePoses[frame][i].rotation.z = poses[i].channeloffset[5];
+
+                if (poses[i].mask & 0x20)
                 {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].normals[vCounter] = normal[i];
-                        if (model.meshes[m].animNormals != NULL) model.meshes[m].animNormals[vCounter] = normal[i];
-                        vCounter++;
-                    }
+                    animations[a].keyframePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
+                    dcounter++;
                 }
-            } break;
-            case IQM_TEXCOORD:
-            {
-                text = (float *)RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
-                //fseek(iqmFile, va[a].offset, SEEK_SET);
-                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
-                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                animations[a].keyframePoses[frame][i].rotation.w = poses[i].channeloffset[6];
+
+                if (poses[i].mask & 0x40)
                 {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
-                    {
-                        model.meshes[m].texcoords[vCounter] = text[i];
-                        vCounter++;
-                    }
+                    animations[a].keyframePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
+                    dcounter++;
                 }
-            } break;
-            case IQM_BLENDINDEXES:
-            {
-                blendi = (char *)RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
-                //fseek(iqmFile, va[a].offset, SEEK_SET);
-                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
-                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                animations[a].keyframePoses[frame][i].scale.x = poses[i].channeloffset[7];
+
+                if (poses[i].mask & 0x80)
                 {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneIndices[boneCounter] = blendi[i];
-                        boneCounter++;
-                    }
+                    animations[a].keyframePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
+                    dcounter++;
                 }
-            } break;
-            case IQM_BLENDWEIGHTS:
-            {
-                blendw = (unsigned char *)RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[a].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                animations[a].keyframePoses[frame][i].scale.y = poses[i].channeloffset[8];
+
+                if (poses[i].mask & 0x100)
                 {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
-                        boneCounter++;
-                    }
+                    animations[a].keyframePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
+                    dcounter++;
                 }
-            } break;
-            case IQM_COLOR:
-            {
-                color = (unsigned char *)RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[a].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                animations[a].keyframePoses[frame][i].scale.z = poses[i].channeloffset[9];
+
+                if (poses[i].mask & 0x200)
                 {
-                    model.meshes[m].colors = (unsigned char *)RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
+                    animations[a].keyframePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
+                    dcounter++;
+                }
 
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].colors[vCounter] = color[i];
-                        vCounter++;
-                    }
+                animations[a].keyframePoses[frame][i].rotation = QuaternionNormalize(animations[a].keyframePoses[frame][i].rotation);
+            }
+        }
+
+        // Build frameposes
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (unsigned int i = 0; i < animations[a].boneCount; i++)
+            {
+                if (bones[i].parent >= 0)
+                {
+                    animations[a].keyframePoses[frame][i].rotation = QuaternionMultiply(animations[a].keyframePoses[frame][bones[i].parent].rotation, animations[a].keyframePoses[frame][i].rotation);
+                    animations[a].keyframePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].keyframePoses[frame][i].translation, animations[a].keyframePoses[frame][bones[i].parent].rotation);
+                    animations[a].keyframePoses[frame][i].translation = Vector3Add(animations[a].keyframePoses[frame][i].translation, animations[a].keyframePoses[frame][bones[i].parent].translation);
+                    animations[a].keyframePoses[frame][i].scale = Vector3Multiply(animations[a].keyframePoses[frame][i].scale, animations[a].keyframePoses[frame][bones[i].parent].scale);
                 }
-            } break;
+            }
         }
+
+        RL_FREE(bones);
     }
 
-    // Bones (joints) data processing
-    ijoint = (IQMJoint *)RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
-    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
-    //fread(ijoint, sizeof(IQMJoint), iqmHeader->num_joints, iqmFile);
-    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+    UnloadFileData(fileData);
 
-    model.skeleton.boneCount = iqmHeader->num_joints;
-    model.skeleton.bones = (BoneInfo *)RL_CALLOC(iqmHeader->num_joints, sizeof(BoneInfo));
-    model.skeleton.bindPose = (Transform *)RL_CALLOC(iqmHeader->num_joints, sizeof(Transform));
+    RL_FREE(joints);
+    RL_FREE(framedata);
+    RL_FREE(poses);
+    RL_FREE(anim);
 
-    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
-    {
-        // Bones
-        model.skeleton.bones[i].parent = ijoint[i].parent;
-        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[a].name, SEEK_SET);
-        //fread(model.bones[a].name, sizeof(char), BONE_NAME_LENGTH, iqmFile);
-        memcpy(model.skeleton.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
+    return animations;
+}
 
-        // Bind pose (base pose)
-        model.skeleton.bindPose[i].translation.x = ijoint[i].translate[0];
-        model.skeleton.bindPose[i].translation.y = ijoint[i].translate[1];
-        model.skeleton.bindPose[i].translation.z = ijoint[i].translate[2];
+#endif
 
-        model.skeleton.bindPose[i].rotation.x = ijoint[i].rotate[0];
-        model.skeleton.bindPose[i].rotation.y = ijoint[i].rotate[1];
-        model.skeleton.bindPose[i].rotation.z = ijoint[i].rotate[2];
-        model.skeleton.bindPose[i].rotation.w = ijoint[i].rotate[3];
+#if SUPPORT_FILEFORMAT_GLTF
+// Load file data callback for cgltf
+static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
+{
+    int filesize;
+    unsigned char *filedata = LoadFileData(path, &filesize);
 
-        model.skeleton.bindPose[i].scale.x = ijoint[i].scale[0];
-        model.skeleton.bindPose[i].scale.y = ijoint[i].scale[1];
-        model.skeleton.bindPose[i].scale.z = ijoint[i].scale[2];
-    }
+    if (filedata == NULL) return cgltf_result_io_error;
 
-    BuildPoseFromParentJoints(model.skeleton.bones, model.skeleton.boneCount, model.skeleton.bindPose);
+    *size = filesize;
+    *data = filedata;
 
-    // Initialize runtime animation data: current pose and bone matrices
-    model.currentPose = (Transform *)RL_CALLOC(model.skeleton.boneCount, sizeof(Transform));
-    model.boneMatrices = (Matrix *)RL_CALLOC(model.skeleton.boneCount, sizeof(Matrix));
-    for (unsigned int j = 0; j < model.skeleton.boneCount; j++) model.boneMatrices[j] = MatrixIdentity();
+    return cgltf_result_success;
+}
 
-    UnloadFileData(fileData);
+// Release file data callback for cgltf
+static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data, cgltf_size size)
+{
+    UnloadFileData((unsigned char *)data);
+}
 
-    RL_FREE(imesh);
-    RL_FREE(tri);
-    RL_FREE(va);
-    RL_FREE(vertex);
-    RL_FREE(normal);
-    RL_FREE(text);
-    RL_FREE(blendi);
-    RL_FREE(blendw);
-    RL_FREE(ijoint);
-    RL_FREE(color);
+// Load image from different glTF provided methods (uri, path, buffer_view)
+// NOTE: Called from worker threads, no shared buffers used (i.e. TextFormat())
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+{
+    Image image = { 0 };
+
+    if (cgltfImage == NULL) return image;
+
+    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
+    {
+        if ((strlen(cgltfImage->uri) > 5) &&
+            (cgltfImage->uri[0] == 'd') &&
+            (cgltfImage->uri[1] == 'a') &&
+            (cgltfImage->uri[2] == 't') &&
+            (cgltfImage->uri[3] == 'a') &&
+            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        {
+            // Data URI Format: data:<mediatype>;base64,<data>
+
+            // Find the comma
+            int i = 0;
+            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+
+            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
+            else
+            {
+                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
+                while (cgltfImage->uri[i + base64Size] == '=') base64Size--;    // Ignore optional paddings
+                int numberOfEncodedBits = base64Size*6 - (base64Size*6)%8;      // Encoded bits minus extra bits, so it becomes a multiple of 8 bits
+                int outSize = numberOfEncodedBits >> 3;                         // Actual encoded bytes
+                void *data = NULL;
+
+                cgltf_options options = { 0 };
+                options.file.read = LoadFileGLTFCallback;
+                options.file.release = ReleaseFileGLTFCallback;
+                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+
+                if (result == cgltf_result_success)
+                {
+                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
+                    RL_FREE(data);
+                }
+            }
+        }
+        else     // Check if image is provided as image path
+        {
+            char imagePath[MAX_FILEPATH_LENGTH] = { 0 };
+            snprintf(imagePath, MAX_FILEPATH_LENGTH, "%s/%s", texPath, cgltfImage->uri);
+            image = LoadImage(imagePath);
+        }
+    }
+    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL)) // Check if image is provided as data buffer
+    {
+        unsigned char *data = (unsigned char *)RL_MALLOC(cgltfImage->buffer_view->size);
+        int offset = (int)cgltfImage->buffer_view->offset;
+        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+
+        // Copy buffer data to memory for loading
+        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
+        {
+            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
+            offset += stride;
+        }
+
+        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
+        // NOTE: Detected that some models define mime_type as "image\\/png"
+        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) || (strcmp(cgltfImage->mime_type, "image/png") == 0))
+        {
+            image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+        }
+        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) || (strcmp(cgltfImage->mime_type, "image/jpeg") == 0))
+        {
+            image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
 
-    return model;
+        RL_FREE(data);
+    }
+
+    return image;
 }
 
-// Load IQM animation data
-static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCount)
+// Load bone info from GLTF skin data
+static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, unsigned int *boneCount)
 {
-    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
-    #define IQM_VERSION     2                   // only IQM version 2 supported
-
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
-
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int dataSize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    *boneCount = (unsigned int)skin.joints_count;
+    BoneInfo *bones = (BoneInfo *)RL_CALLOC(skin.joints_count, sizeof(BoneInfo));
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    for (unsigned int i = 0; i < skin.joints_count; i++)
+    {
+        cgltf_node node = *skin.joints[i];
+        if (node.name != NULL) snprintf(bones[i].name, sizeof(bones[i].name), "%s", node.name);
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+        // Find parent bone index by walking up the node tree past any
+        // non-joint ancestors (intermediate transform nodes used by some
+        // DCC exporters), until we hit a node that is also in skin.joints.
+        int parentIndex = -1;
+        cgltf_node *ancestor = node.parent;
+        while (ancestor != NULL && parentIndex == -1)
+        {
+            for (unsigned int j = 0; j < skin.joints_count; j++)
+            {
+                if (skin.joints[j] == ancestor) { parentIndex = (int)j; break; }
+            }
+            if (parentIndex == -1) ancestor = ancestor->parent;
+        }
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+        bones[i].parent = parentIndex;
+    }
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return NULL;
+    return bones;
+}
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+// Load texture from glTF decoded image (images loaded by LoadDataGLTF())
+// NOTE: Texture is loaded once per image, shared by all materials using it
+static Texture2D LoadTextureGLTF(cgltf_data *data, cgltf_texture *texture, Image *images, Texture2D *textures)
+{
+    Texture2D result = { 0 };
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    if ((texture != NULL) && (texture->image != NULL))
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        UnloadFileData(fileData);
-        return NULL;
-    }
+        int index = (int)(texture->image - data->images);
 
-    if (iqmHeader->version != IQM_VERSION)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        UnloadFileData(fileData);
-        return NULL;
+        if ((textures[index].id == 0) && (images[index].data != NULL)) textures[index] = LoadTextureFromImage(images[index]);
+        result = textures[index];
     }
 
-    // Get bones data
-    IQMPose *poses = (IQMPose *)RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
-    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
-    //fread(poses, sizeof(IQMPose), iqmHeader->num_poses, iqmFile);
-    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
+    return result;
+}
 
-    // Get animations data
-    *animCount = iqmHeader->num_anims;
-    IQMAnim *anim = (IQMAnim *)RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
-    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
-    //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
-    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
+// Macro to simplify attributes loading code
+// NOTE: Tightly packed attributes (no interleaved data) are copied at once
+#define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) \
+{ \
+    if (accesor->stride == numComp*sizeof(srcType)) \
+    { \
+        srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
+        memcpy(dstPtr, buffer, accesor->count*numComp*sizeof(srcType)); \
+    } \
+    else LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType) \
+}
 
-    ModelAnimation *animations = (ModelAnimation *)RL_CALLOC(iqmHeader->num_anims, sizeof(ModelAnimation));
+#define LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, dstType) \
+{ \
+    int n = 0; \
+    srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
+    for (unsigned int k = 0; k < accesor->count; k++) \
+    {\
+        for (int l = 0; l < numComp; l++) \
+        {\
+            dstPtr[numComp*k + l] = (dstType)buffer[n + l];\
+        }\
+        n += (int)(accesor->stride/sizeof(srcType));\
+    }\
+}
 
-    // frameposes
-    unsigned short *framedata = (unsigned short *)RL_CALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels, sizeof(unsigned short));
-    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
-    //fread(framedata, sizeof(unsigned short), iqmHeader->num_frames*iqmHeader->num_framechannels, iqmFile);
-    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+// Load glTF primitive data into mesh, transform applied to vertices, normals and tangents
+// NOTE: Called from worker threads, only mesh data and mesh material index are written
+static void LoadPrimitiveGLTF(const char *fileName, cgltf_data *data, cgltf_primitive *primitive, Matrix worldMatrix, Mesh *mesh, int *meshMaterial)
+{
+    Matrix worldMatrixNormals = MatrixTranspose(MatrixInvert(worldMatrix));
+    Matrix identity = MatrixIdentity();
+    bool transformData = (memcmp(&worldMatrix, &identity, sizeof(Matrix)) != 0);    // Identity transform skipped
 
-    // joints
-    IQMJoint *joints = (IQMJoint *)RL_CALLOC(iqmHeader->num_joints, sizeof(IQMJoint));
-    memcpy(joints, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+    // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
+    // Only some formats for each attribute type are supported, read info at the top of LoadGLTF()!
 
-    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    for (unsigned int j = 0; j < primitive->attributes_count; j++)
     {
-        animations[a].boneCount = iqmHeader->num_poses;
-        BoneInfo *bones = (BoneInfo *)RL_CALLOC(iqmHeader->num_poses, sizeof(BoneInfo));
+        // Check the different attributes for every primitive
+        if (primitive->attributes[j].type == cgltf_attribute_type_position)      // POSITION, vec3, float
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
 
-        animations[a].keyframeCount = anim[a].num_frames;
-        animations[a].keyframePoses = (Transform **)RL_CALLOC(anim[a].num_frames, sizeof(Transform *));
-        memcpy(animations[a].name, fileDataPtr + iqmHeader->ofs_text + anim[a].name, 32);
-        // TODO: Use animation framerate data?
-        //animations[a].framerate = anim.framerate;
+            // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined
 
-        TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s | Frames: %d | Framerate: %f", fileName, animations[a].name, animations[a].keyframeCount, anim[a].framerate);
+            if (mesh->vertices != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data already loaded", fileName);
+            else
+            {
+                if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
+                {
+                    // Init raylib mesh vertices to copy glTF attribute data
+                    mesh->vertexCount = (int)attribute->count;
+                    mesh->vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
 
-        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
-        {
-            bones[j].parent = poses[j].parent;
+                    // Load 3 components of float data type into mesh.vertices
+                    LOAD_ATTRIBUTE(attribute, 3, float, mesh->vertices)
 
-            // NOTE: No need to store bones names, bones only required to generate keyframe poses
-            //if (iqmHeader->num_joints > 0) memcpy(bones[j].name, fileDataPtr + iqmHeader->ofs_text + joints[j].name, BONE_NAME_LENGTH*sizeof(char));
-            //else memcpy(bones[j].name, "ANIMJOINTNAME", 13); // Default bone name otherwise
-        }
+                    // Transform the vertices
+                    if (transformData)
+                    {
+                        float *vertices = mesh->vertices;
+                        for (unsigned int k = 0; k < attribute->count; k++)
+                        {
+                            Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k+1], vertices[3*k+2] }, worldMatrix);
+                            vertices[3*k] = vt.x;
+                            vertices[3*k+1] = vt.y;
+                            vertices[3*k+2] = vt.z;
+                        }
+                    }
+                }
+                else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_16u))
+                {
+                    // Init raylib mesh vertices to copy glTF attribute data
+                    mesh->vertexCount = (int)attribute->count;
+                    mesh->vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
 
-        for (unsigned int j = 0; j < anim[a].num_frames; j++)
-            animations[a].keyframePoses[j] = (Transform *)RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*3*sizeof(unsigned short));
+                    LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
 
-        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
+                    // Convert data to raylib vertex data type (float) the matrix will scale it to the correct size as a float
+                    for (unsigned int t = 0; t < attribute->count*3; t++) mesh->vertices[t] = (float)temp[t];
 
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
-            {
-                animations[a].keyframePoses[frame][i].translation.x = poses[i].channeloffset[0];
+                    RL_FREE(temp);
 
-                if (poses[i].mask & 0x01)
-                {
-                    animations[a].keyframePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
-                    dcounter++;
+                    // Transform the vertices
+                    if (transformData)
+                    {
+                        float *vertices = mesh->vertices;
+                        for (unsigned int k = 0; k < attribute->count; k++)
+                        {
+                            Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k + 1], vertices[3*k + 2] }, worldMatrix);
+                            vertices[3*k] = vt.x;
+                            vertices[3*k + 1] = vt.y;
+                            vertices[3*k + 2] = vt.z;
+                        }
+                    }
                 }
+                else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_16))
+                {
+                    // Init raylib mesh vertices to copy glTF attribute data
+                    mesh->vertexCount = (int)attribute->count;
+                    mesh->vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
 
-                animations[a].keyframePoses[frame][i].translation.y = poses[i].channeloffset[1];
+                    // Load data into a temp buffer to be converted to raylib data type
+                    short *temp = (short *)RL_MALLOC(attribute->count*3*sizeof(short));
+                    LOAD_ATTRIBUTE(attribute, 3, short, temp);
 
-                if (poses[i].mask & 0x02)
-                {
-                    animations[a].keyframePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
-                    dcounter++;
-                }
+                    // Convert data to raylib vertex data type (float) the matrix will scale it to the correct size as a float
+                    for (unsigned int t = 0; t < attribute->count*3; t++) mesh->vertices[t] = (float)temp[t];
 
-                animations[a].keyframePoses[frame][i].translation.z = poses[i].channeloffset[2];
+                    RL_FREE(temp);
 
-                if (poses[i].mask & 0x04)
-                {
-                    animations[a].keyframePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
-                    dcounter++;
+                    // Transform the vertices
+                    if (transformData)
+                    {
+                        float *vertices = mesh->vertices;
+                        for (unsigned int k = 0; k < attribute->count; k++)
+                        {
+                            Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k + 1], vertices[3*k + 2] }, worldMatrix);
+                            vertices[3*k] = vt.x;
+                            vertices[3*k + 1] = vt.y;
+                            vertices[3*k + 2] = vt.z;
+                        }
+                    }
                 }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
+            }
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_normal) // NORMAL, vec3, float
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
 
-                animations[a].keyframePoses[frame][i].rotation.x = poses[i].channeloffset[3];
-
-                if (poses[i].mask & 0x08)
+            if (mesh->normals != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Normals attribute data already loaded", fileName);
+            else
+            {
+                if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
                 {
-                    animations[a].keyframePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
-                    dcounter++;
-                }
+                    // Init raylib mesh normals to copy glTF attribute data
+                    mesh->normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
 
-                animations[a].keyframePoses[frame][i].rotation.y = poses[i].channeloffset[4];
+                    // Load 3 components of float data type into mesh.normals
+                    LOAD_ATTRIBUTE(attribute, 3, float, mesh->normals)
 
-                if (poses[i].mask & 0x10)
-                {
-                    animations[a].keyframePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
-                    dcounter++;
+                    // Transform the normals
+                    if (transformData)
+                    {
+                        float *normals = mesh->normals;
+                        for (unsigned int k = 0; k < attribute->count; k++)
+                        {
+                            Vector3 nt = Vector3Transform((Vector3){ normals[3*k], normals[3*k+1], normals[3*k+2] }, worldMatrixNormals);
+                            normals[3*k] = nt.x;
+                            normals[3*k+1] = nt.y;
+                            normals[3*k+2] = nt.z;
+                        }
+                    }
                 }
+                else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_16))
+                {
+                    // Init raylib mesh normals to copy glTF attribute data
+                    mesh->normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
 
-                animations[a].keyframePoses[frame][i].rotation.z = poses[i].channeloffset[5];
+                    // Load data into a temp buffer to be converted to raylib data type
+                    short *temp = (short *)RL_MALLOC(attribute->count*3*sizeof(short));
+                    LOAD_ATTRIBUTE(attribute, 3, short, temp);
 
-                if (poses[i].mask & 0x20)
-                {
-                    animations[a].keyframePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
-                    dcounter++;
-                }
+                    // Convert data to raylib normal data type (float)
+                    for (unsigned int t = 0; t < attribute->count*3; t++) mesh->normals[t] = (float)temp[t];
 
-                animations[a].keyframePoses[frame][i].rotation.w = poses[i].channeloffset[6];
+                    RL_FREE(temp);
 
-                if (poses[i].mask & 0x40)
+                    // Transform the normals
+                    float *normals = mesh->normals;
+                    for (unsigned int k = 0; k < attribute->count; k++)
+                    {
+                        Vector3 nt = Vector3Normalize(Vector3Transform((Vector3){ normals[3*k], normals[3*k + 1], normals[3*k + 2] }, worldMatrixNormals));
+                        normals[3*k] = nt.x;
+                        normals[3*k + 1] = nt.y;
+                        normals[3*k + 2] = nt.z;
+                    }
+                }
+                else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_8u))
                 {
-                    animations[a].keyframePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
-                    dcounter++;
+                    // Init raylib mesh normals to copy glTF attribute data
+                    mesh->normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*3*sizeof(unsigned char));
+                    LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
+
+                    // Convert data to raylib normal data type (float)
+                    for (unsigned int t = 0; t < attribute->count*3; t++) mesh->normals[t] = (float)temp[t];
+
+                    RL_FREE(temp);
+
+                    // Transform the normals
+                    float *normals = mesh->normals;
+                    for (unsigned int k = 0; k < attribute->count; k++)
+                    {
+                        Vector3 nt = Vector3Normalize(Vector3Transform((Vector3){ normals[3*k], normals[3*k + 1], normals[3*k + 2] }, worldMatrixNormals));
+                        normals[3*k] = nt.x;
+                        normals[3*k + 1] = nt.y;
+                        normals[3*k + 2] = nt.z;
+                    }
                 }
+                else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_8))
+                {
+                    // Init raylib mesh normals to copy glTF attribute data
+                    mesh->normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
 
-                animations[a].keyframePoses[frame][i].scale.x = poses[i].channeloffset[7];
+                    // Load data into a temp buffer to be converted to raylib data type
+                    char *temp = (char *)RL_MALLOC(attribute->count*3*sizeof(char));
+                    LOAD_ATTRIBUTE(attribute, 3, char, temp);
 
-                if (poses[i].mask & 0x80)
+                    // Convert data to raylib normal data type (float)
+                    for (unsigned int t = 0; t < attribute->count*3; t++) mesh->normals[t] = (float)temp[t];
+
+                    RL_FREE(temp);
+
+                    // Transform the normals
+                    float *normals = mesh->normals;
+                    for (unsigned int k = 0; k < attribute->count; k++)
+                    {
+                        Vector3 nt = Vector3Normalize(Vector3Transform((Vector3){ normals[3*k], normals[3*k + 1], normals[3*k + 2] }, worldMatrixNormals));
+                        normals[3*k] = nt.x;
+                        normals[3*k + 1] = nt.y;
+                        normals[3*k + 2] = nt.z;
+                    }
+                }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Normals attribute data format not supported, use vec3 float", fileName);
+            }
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_tangent) // TANGENT, vec4, float, w is tangent basis sign
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
+
+            if (mesh->tangents != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Tangents attribute data already loaded", fileName);
+            else
+            {
+                if ((attribute->type == cgltf_type_vec4) && (attribute->component_type == cgltf_component_type_r_32f))
                 {
-                    animations[a].keyframePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
-                    dcounter++;
+                    // Init raylib mesh tangent to copy glTF attribute data
+                    mesh->tangents = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
+
+                    // Load 4 components of float data type into mesh.tangents
+                    LOAD_ATTRIBUTE(attribute, 4, float, mesh->tangents)
+
+                    // Transform the tangents
+                    if (transformData)
+                    {
+                        float *tangents = mesh->tangents;
+                        for (unsigned int k = 0; k < attribute->count; k++)
+                        {
+                            Vector3 tt = Vector3Transform((Vector3){ tangents[4*k], tangents[4*k+1], tangents[4*k+2] }, worldMatrix);
+                            tangents[4*k] = tt.x;
+                            tangents[4*k+1] = tt.y;
+                            tangents[4*k+2] = tt.z;
+                        }
+                    }
                 }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangents attribute data format not supported, use vec4 float", fileName);
+            }
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_n, vec2, float/u8n/u16n
+        {
+            // Support up to 2 texture coordinates attributes
+            float *texcoordPtr = NULL;
 
-                animations[a].keyframePoses[frame][i].scale.y = poses[i].channeloffset[8];
+            cgltf_accessor *attribute = primitive->attributes[j].data;
 
-                if (poses[i].mask & 0x100)
+            if (attribute->type == cgltf_type_vec2)
+            {
+                if (attribute->component_type == cgltf_component_type_r_32f) // vec2, float
                 {
-                    animations[a].keyframePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
-                    dcounter++;
+                    // Init raylib mesh texcoords to copy glTF attribute data
+                    texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
+
+                    // Load 3 components of float data type into mesh.texcoords
+                    LOAD_ATTRIBUTE(attribute, 2, float, texcoordPtr)
                 }
+                else if (attribute->component_type == cgltf_component_type_r_8u) // vec2, u8n
+                {
+                    // Init raylib mesh texcoords to copy glTF attribute data
+                    texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
 
-                animations[a].keyframePoses[frame][i].scale.z = poses[i].channeloffset[9];
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*2*sizeof(unsigned char));
+                    LOAD_ATTRIBUTE(attribute, 2, unsigned char, temp);
 
-                if (poses[i].mask & 0x200)
-                {
-                    animations[a].keyframePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
-                    dcounter++;
+                    // Convert data to raylib texcoord data type (float)
+                    for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/255.0f;
+
+                    RL_FREE(temp);
                 }
+                else if (attribute->component_type == cgltf_component_type_r_16u) // vec2, u16n
+                {
+                    // Init raylib mesh texcoords to copy glTF attribute data
+                    texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
 
-                animations[a].keyframePoses[frame][i].rotation = QuaternionNormalize(animations[a].keyframePoses[frame][i].rotation);
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*2*sizeof(unsigned short));
+                    LOAD_ATTRIBUTE(attribute, 2, unsigned short, temp);
+
+                    // Convert data to raylib texcoord data type (float)
+                    for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/65535.0f;
+
+                    RL_FREE(temp);
+                }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported", fileName);
             }
-        }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
 
-        // Build frameposes
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (unsigned int i = 0; i < animations[a].boneCount; i++)
+            int index = primitive->attributes[j].index;
+            if (index == 0) mesh->texcoords = texcoordPtr;
+            else if (index == 1) mesh->texcoords2 = texcoordPtr;
+            else
             {
-                if (bones[i].parent >= 0)
-                {
-                    animations[a].keyframePoses[frame][i].rotation = QuaternionMultiply(animations[a].keyframePoses[frame][bones[i].parent].rotation, animations[a].keyframePoses[frame][i].rotation);
-                    animations[a].keyframePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].keyframePoses[frame][i].translation, animations[a].keyframePoses[frame][bones[i].parent].rotation);
-                    animations[a].keyframePoses[frame][i].translation = Vector3Add(animations[a].keyframePoses[frame][i].translation, animations[a].keyframePoses[frame][bones[i].parent].translation);
-                    animations[a].keyframePoses[frame][i].scale = Vector3Multiply(animations[a].keyframePoses[frame][i].scale, animations[a].keyframePoses[frame][bones[i].parent].scale);
-                }
+                TRACELOG(LOG_WARNING, "MODEL: [%s] No more than 2 texture coordinates attributes supported", fileName);
+                if (texcoordPtr != NULL) RL_FREE(texcoordPtr);
             }
         }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_color) // COLOR_n, vec3/vec4, float/u8n/u16n
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
 
-        RL_FREE(bones);
-    }
+            // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range
 
-    UnloadFileData(fileData);
+            if (mesh->colors != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Colors attribute data already loaded", fileName);
+            else
+            {
+                if (attribute->type == cgltf_type_vec3) // RGB
+                {
+                    if (attribute->component_type == cgltf_component_type_r_8u)
+                    {
+                        // Init raylib mesh color to copy glTF attribute data
+                        mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-    RL_FREE(joints);
-    RL_FREE(framedata);
-    RL_FREE(poses);
-    RL_FREE(anim);
+                        // Load data into a temp buffer to be converted to raylib data type
+                        unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*3*sizeof(unsigned char));
+                        LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
 
-    return animations;
-}
+                        // Convert data to raylib color data type (4 bytes)
+                        for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
+                        {
+                            mesh->colors[c] = temp[k];
+                            mesh->colors[c + 1] = temp[k + 1];
+                            mesh->colors[c + 2] = temp[k + 2];
+                            mesh->colors[c + 3] = 255;
+                        }
 
-#endif
+                        RL_FREE(temp);
+                    }
+                    else if (attribute->component_type == cgltf_component_type_r_16u)
+                    {
+                        // Init raylib mesh color to copy glTF attribute data
+                        mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-#if SUPPORT_FILEFORMAT_GLTF
-// Load file data callback for cgltf
-static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
-{
-    int filesize;
-    unsigned char *filedata = LoadFileData(path, &filesize);
+                        // Load data into a temp buffer to be converted to raylib data type
+                        unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*3*sizeof(unsigned short));
+                        LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
 
-    if (filedata == NULL) return cgltf_result_io_error;
+                        // Convert data to raylib color data type (4 bytes)
+                        for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
+                        {
+                            mesh->colors[c] = (unsigned char)(((float)temp[k]/65535.0f)*255.0f);
+                            mesh->colors[c + 1] = (unsigned char)(((float)temp[k + 1]/65535.0f)*255.0f);
+                            mesh->colors[c + 2] = (unsigned char)(((float)temp[k + 2]/65535.0f)*255.0f);
+                            mesh->colors[c + 3] = 255;
+                        }
 
-    *size = filesize;
-    *data = filedata;
+                        RL_FREE(temp);
+                    }
+                    else if (attribute->component_type == cgltf_component_type_r_32f)
+                    {
+                        // Init raylib mesh color to copy glTF attribute data
+                        mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-    return cgltf_result_success;
-}
+                        // Load data into a temp buffer to be converted to raylib data type
+                        float *temp = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+                        LOAD_ATTRIBUTE(attribute, 3, float, temp);
 
-// Release file data callback for cgltf
-static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data, cgltf_size size)
-{
-    UnloadFileData((unsigned char *)data);
-}
+                        // Convert data to raylib color data type (4 bytes)
+                        for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
+                        {
+                            mesh->colors[c] = (unsigned char)(temp[k]*255.0f);
+                            mesh->colors[c + 1] = (unsigned char)(temp[k + 1]*255.0f);
+                            mesh->colors[c + 2] = (unsigned char)(temp[k + 2]*255.0f);
+                            mesh->colors[c + 3] = 255;
+                        }
 
-// Load image from different glTF provided methods (uri, path, buffer_view)
-static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
-{
-    Image image = { 0 };
+                        RL_FREE(temp);
+                    }
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+                }
+                else if (attribute->type == cgltf_type_vec4) // RGBA
+                {
+                    if (attribute->component_type == cgltf_component_type_r_8u)
+                    {
+                        // Init raylib mesh color to copy glTF attribute data
+                        mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-    if (cgltfImage == NULL) return image;
+                        // Load 4 components of unsigned char data type into mesh.colors
+                        LOAD_ATTRIBUTE(attribute, 4, unsigned char, mesh->colors)
+                    }
+                    else if (attribute->component_type == cgltf_component_type_r_16u)
+                    {
+                        // Init raylib mesh color to copy glTF attribute data
+                        mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
-    {
-        if ((strlen(cgltfImage->uri) > 5) &&
-            (cgltfImage->uri[0] == 'd') &&
-            (cgltfImage->uri[1] == 'a') &&
-            (cgltfImage->uri[2] == 't') &&
-            (cgltfImage->uri[3] == 'a') &&
-            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
-        {
-            // Data URI Format: data:<mediatype>;base64,<data>
+                        // Load data into a temp buffer to be converted to raylib data type
+                        unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*4*sizeof(unsigned short));
+                        LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
 
-            // Find the comma
-            int i = 0;
-            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+                        // Convert data to raylib color data type (4 bytes)
+                        for (unsigned int c = 0; c < attribute->count*4; c++) mesh->colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
 
-            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
-            else
-            {
-                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
-                while (cgltfImage->uri[i + base64Size] == '=') base64Size--;    // Ignore optional paddings
-                int numberOfEncodedBits = base64Size*6 - (base64Size*6)%8;      // Encoded bits minus extra bits, so it becomes a multiple of 8 bits
-                int outSize = numberOfEncodedBits >> 3;                         // Actual encoded bytes
-                void *data = NULL;
+                        RL_FREE(temp);
+                    }
+                    else if (attribute->component_type == cgltf_component_type_r_32f)
+                    {
+                        // Init raylib mesh color to copy glTF attribute data
+                        mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-                cgltf_options options = { 0 };
-                options.file.read = LoadFileGLTFCallback;
-                options.file.release = ReleaseFileGLTFCallback;
-                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+                        // Load data into a temp buffer to be converted to raylib data type
+                        float *temp = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
+                        LOAD_ATTRIBUTE(attribute, 4, float, temp);
 
-                if (result == cgltf_result_success)
-                {
-                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
-                    RL_FREE(data);
+                        // Convert data to raylib color data type (4 bytes), color data must be normalized
+                        for (unsigned int c = 0; c < attribute->count*4; c++) mesh->colors[c] = (unsigned char)(temp[c]*255.0f);
+
+                        RL_FREE(temp);
+                    }
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
                 }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
             }
         }
-        else     // Check if image is provided as image path
-        {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
-        }
+
+        // NOTE: Attributes related to animations data are processed after mesh data loading
     }
-    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL)) // Check if image is provided as data buffer
+
+    // Load primitive indices data (if provided)
+    if ((primitive->indices != NULL) && (primitive->indices->buffer_view != NULL))
     {
-        unsigned char *data = (unsigned char *)RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+        cgltf_accessor *attribute = primitive->indices;
 
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
-        {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+        mesh->triangleCount = (int)attribute->count/3;
 
-        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
-        // NOTE: Detected that some models define mime_type as "image\\/png"
-        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) || (strcmp(cgltfImage->mime_type, "image/png") == 0))
+        if ((mesh->indices != NULL) || (mesh->indices32 != NULL)) TRACELOG(LOG_WARNING, "MODEL: [%s] Indices attribute data already loaded", fileName);
+        else
         {
-            image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+            if (attribute->component_type == cgltf_component_type_r_16u)
+            {
+                // Init raylib mesh indices to copy glTF attribute data
+                mesh->indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
+
+                // Load unsigned short data type into mesh.indices
+                LOAD_ATTRIBUTE(attribute, 1, unsigned short, mesh->indices)
+            }
+            else if (attribute->component_type == cgltf_component_type_r_8u)
+            {
+                // Init raylib mesh indices to copy glTF attribute data
+                mesh->indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
+                LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned char, mesh->indices, unsigned short)
+
+            }
+            else if (attribute->component_type == cgltf_component_type_r_32u)
+            {
+                if (mesh->vertexCount > 65535)
+                {
+                    // Init raylib mesh 32bit indices to copy glTF attribute data
+                    mesh->indices32 = (unsigned int *)RL_MALLOC(attribute->count*sizeof(unsigned int));
+                    LOAD_ATTRIBUTE(attribute, 1, unsigned int, mesh->indices32)
+                }
+                else
+                {
+                    // Indices fit in 16bit, no data lost on conversion
+                    mesh->indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
+                    LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned int, mesh->indices, unsigned short);
+                }
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16 or u32", fileName);
         }
-        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) || (strcmp(cgltfImage->mime_type, "image/jpeg") == 0))
+    }
+    else mesh->triangleCount = mesh->vertexCount/3;    // Unindexed mesh
+
+    // Assign to the primitive mesh the corresponding material index
+    // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
+    for (unsigned int m = 0; m < data->materials_count; m++)
+    {
+        // The primitive actually keeps the pointer to the corresponding material,
+        // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
+        // To get the index, check if material pointers match, and assign the corresponding index,
+        // skipping index 0, the default material
+        if (&data->materials[m] == primitive->material)
         {
-            image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+            *meshMaterial = m + 1;
+            break;
         }
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
-
-        RL_FREE(data);
     }
-
-    return image;
 }
 
-// Load bone info from GLTF skin data
-static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, unsigned int *boneCount)
+// Load glTF data task (LoadTaskGLTF), images and primitives processed interleaved between tasks
+// NOTE: Images are loaded from files using LoadFileData(), custom file callbacks must be thread-safe
+static void LoadDataGLTF(void *data)
 {
-    *boneCount = (unsigned int)skin.joints_count;
-    BoneInfo *bones = (BoneInfo *)RL_CALLOC(skin.joints_count, sizeof(BoneInfo));
+    LoadTaskGLTF *task = (LoadTaskGLTF *)data;
 
-    for (unsigned int i = 0; i < skin.joints_count; i++)
+    for (unsigned int i = task->first; i < task->data->images_count; i += task->step)
     {
-        cgltf_node node = *skin.joints[i];
-        if (node.name != NULL) snprintf(bones[i].name, sizeof(bones[i].name), "%s", node.name);
-
-        // Find parent bone index by walking up the node tree past any
-        // non-joint ancestors (intermediate transform nodes used by some
-        // DCC exporters), until we hit a node that is also in skin.joints.
-        int parentIndex = -1;
-        cgltf_node *ancestor = node.parent;
-        while (ancestor != NULL && parentIndex == -1)
-        {
-            for (unsigned int j = 0; j < skin.joints_count; j++)
-            {
-                if (skin.joints[j] == ancestor) { parentIndex = (int)j; break; }
-            }
-            if (parentIndex == -1) ancestor = ancestor->parent;
-        }
-
-        bones[i].parent = parentIndex;
+        if (task->imageUsed[i]) task->images[i] = LoadImageFromCgltfImage(&task->data->images[i], task->texPath);
     }
 
-    return bones;
+    for (int i = task->first; i < task->meshCount; i += task->step)
+    {
+        LoadPrimitiveGLTF(task->fileName, task->data, task->primitives[i].primitive, task->primitives[i].transform, &task->meshes[i], &task->meshMaterial[i]);
+    }
 }
 
 // Load glTF file into model struct, .gltf and .glb supported
@@ -5429,7 +10024,8 @@ static Model LoadGLTF(const char *fileName)
           - Transforms, including parent-child relations, are applied on the mesh data,
             but the hierarchy is not kept (as it can't be represented)
           - Mesh instances in the glTF file (a.e. same mesh linked from multiple nodes)
-            are turned into separate raylib Meshes
+            are loaded once and drawn by model instances (node transform per instance)
+          - Material images are decoded once and primitives converted on worker threads
 
         RESTRICTIONS:
           - Only triangle meshes supported
@@ -5438,28 +10034,11 @@ static Model LoadGLTF(const char *fileName)
               > Normals: vec3: float
               > Texcoords: vec2: float
               > Colors: vec4: u8, u16, f32 (normalized)
-              > Indices: u16, u32 (truncated to u16)
+              > Indices: u8, u16, u32 (u32 kept for meshes with more than 65535 vertices, converted to u16 otherwise)
           - Scenes defined in the glTF file are ignored. All nodes in the file are used
 
     ***********************************************************************************************/
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType)
-
-    #define LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, dstType) \
-    { \
-        int n = 0; \
-        srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
-        for (unsigned int k = 0; k < accesor->count; k++) \
-        {\
-            for (int l = 0; l < numComp; l++) \
-            {\
-                dstPtr[numComp*k + l] = (dstType)buffer[n + l];\
-            }\
-            n += (int)(accesor->stride/sizeof(srcType));\
-        }\
-    }
-
     Model model = { 0 };
 
     // glTF file loading
@@ -5525,8 +10104,95 @@ static Model LoadGLTF(const char *fileName)
 
         TRACELOG(LOG_DEBUG, "    > Primitives (triangles only) count based on hierarchy : %i", primitivesCount);
 
+        // Load meshes data
+        //
+        // NOTE: Visit each node in the hierarchy and process any mesh linked from it
+        //  - Each primitive within a glTF node becomes a raylib Mesh
+        //  - The local-to-world transform of each node is used to transform the points/normals/tangents of the created Mesh(es)
+        //  - Any glTF mesh linked from more than one Node (a.e. instancing) is loaded once without transform,
+        //    the model is drawn by instances (model.instanceMeshes), every node keeps its transform (model.instanceTransforms)
+        //  - Skinned models meshes are not shared, every node mesh data is transformed as required by animation
+        //
+        // WARNING: The code below disregards the scenes defined in the file, all nodes are used
+        //----------------------------------------------------------------------------------------------------
+        int *meshNodeCount = (int *)RL_CALLOC(data->meshes_count, sizeof(int));     // Nodes linking every glTF mesh
+        int *meshFirstIndex = (int *)RL_MALLOC(data->meshes_count*sizeof(int));     // Model mesh index of every shared glTF mesh, once loaded
+        bool instancing = false;
+
+        for (unsigned int i = 0; i < data->nodes_count; i++)
+        {
+            if (data->nodes[i].mesh != NULL) meshNodeCount[data->nodes[i].mesh - data->meshes]++;
+        }
+
+        for (unsigned int i = 0; i < data->meshes_count; i++)
+        {
+            meshFirstIndex[i] = -1;
+            if ((meshNodeCount[i] > 1) && (data->skins_count == 0)) instancing = true;
+        }
+
+        PrimitiveGLTF *primitives = (PrimitiveGLTF *)RL_CALLOC(primitivesCount, sizeof(PrimitiveGLTF));
+
+        if (instancing)
+        {
+            model.instanceMeshes = (int *)RL_CALLOC(primitivesCount, sizeof(int));
+            model.instanceTransforms = (Matrix *)RL_CALLOC(primitivesCount, sizeof(Matrix));
+        }
+
+        for (unsigned int i = 0; i < data->nodes_count; i++)
+        {
+            cgltf_node *node = &(data->nodes[i]);
+
+            cgltf_mesh *mesh = node->mesh;
+            if (!mesh) continue;
+
+            cgltf_float worldTransform[16];
+            cgltf_node_transform_world(node, worldTransform);
+
+            Matrix worldMatrix = {
+                worldTransform[0], worldTransform[4], worldTransform[8], worldTransform[12],
+                worldTransform[1], worldTransform[5], worldTransform[9], worldTransform[13],
+                worldTransform[2], worldTransform[6], worldTransform[10], worldTransform[14],
+                worldTransform[3], worldTransform[7], worldTransform[11], worldTransform[15]
+            };
+
+            int m = (int)(mesh - data->meshes);
+            bool shared = (meshNodeCount[m] > 1) && (data->skins_count == 0);
+            bool loaded = shared && (meshFirstIndex[m] >= 0);
+            int meshIndex = loaded? meshFirstIndex[m] : model.meshCount;
+
+            if (shared) meshFirstIndex[m] = meshIndex;
+
+            for (unsigned int p = 0; p < mesh->primitives_count; p++)
+            {
+                // NOTE: Only support primitives defined by triangles
+                // Other alternatives: points, lines, line_strip, triangle_strip
+                if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
+
+                if (!loaded)
+                {
+                    primitives[model.meshCount].node = node;
+                    primitives[model.meshCount].primitive = &mesh->primitives[p];
+                    primitives[model.meshCount].transform = shared? MatrixIdentity() : worldMatrix;
+                    model.meshCount++;
+                }
+
+                if (instancing)
+                {
+                    model.instanceMeshes[model.instanceCount] = meshIndex;
+                    model.instanceTransforms[model.instanceCount] = shared? worldMatrix : MatrixIdentity();
+                    model.instanceCount++;
+                }
+
+                meshIndex++;       // Move to next mesh
+            }
+        }
+
+        RL_FREE(meshNodeCount);
+        RL_FREE(meshFirstIndex);
+
+        TRACELOG(LOG_DEBUG, "    > Meshes loaded (instances shared): %i", model.meshCount);
+
         // Load our model data: meshes and materials
-        model.meshCount = primitivesCount;
         model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
 
         // NOTE: Keep an extra slot for default material, in case some mesh requires it
@@ -5534,15 +10200,80 @@ static Model LoadGLTF(const char *fileName)
         model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
         model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
 
-        // Load mesh-material indices, by default all meshes are mapped to material index: 0
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+        // Load mesh-material indices, by default all meshes are mapped to material index: 0
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+        // Check images used by materials, every image is decoded once, even if used by multiple materials
+        Image *images = (Image *)RL_CALLOC(data->images_count, sizeof(Image));
+        bool *imageUsed = (bool *)RL_CALLOC(data->images_count, sizeof(bool));
+        int imageCount = 0;
+
+        for (unsigned int i = 0; i < data->materials_count; i++)
+        {
+            if (!data->materials[i].has_pbr_metallic_roughness) continue;
+
+            cgltf_texture *textures[5] = {
+                data->materials[i].pbr_metallic_roughness.base_color_texture.texture,
+                data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture,
+                data->materials[i].normal_texture.texture,
+                data->materials[i].occlusion_texture.texture,
+                data->materials[i].emissive_texture.texture
+            };
+
+            for (int t = 0; t < 5; t++)
+            {
+                if ((textures[t] != NULL) && (textures[t]->image != NULL) && !imageUsed[textures[t]->image - data->images])
+                {
+                    imageUsed[textures[t]->image - data->images] = true;
+                    imageCount++;
+                }
+            }
+        }
+
+        // Load primitives data and decode images, work split between worker threads
+        // NOTE: Images decoding and attributes conversion do not require the graphics context
+        char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+        snprintf(texPath, MAX_FILEPATH_LENGTH, "%s", GetDirectoryPath(fileName));
+
+        LoadTaskGLTF tasks[MAX_MODELS_THREADS] = { 0 };
+        int taskCount = 1;
+#if SUPPORT_MODELS_THREADING
+        taskCount = (model.meshCount > imageCount)? model.meshCount : imageCount;
+        if (taskCount > MAX_MODELS_THREADS) taskCount = MAX_MODELS_THREADS;
+        if (taskCount < 1) taskCount = 1;
+#endif
+        for (int t = 0; t < taskCount; t++)
+        {
+            tasks[t].fileName = fileName;
+            tasks[t].texPath = texPath;
+            tasks[t].data = data;
+            tasks[t].primitives = primitives;
+            tasks[t].meshes = model.meshes;
+            tasks[t].meshMaterial = model.meshMaterial;
+            tasks[t].meshCount = model.meshCount;
+            tasks[t].images = images;
+            tasks[t].imageUsed = imageUsed;
+            tasks[t].first = t;
+            tasks[t].step = taskCount;
+        }
+
+#if SUPPORT_MODELS_THREADING
+        if (taskCount > 1) RunParallelTasks(LoadDataGLTF, tasks, taskCount, sizeof(LoadTaskGLTF));
+        else LoadDataGLTF(&tasks[0]);
+#else
+        LoadDataGLTF(&tasks[0]);
+#endif
+
+        // Textures loaded from decoded images, shared by materials using the same image
+        Texture2D *textures = (Texture2D *)RL_CALLOC(data->images_count, sizeof(Texture2D));
+        Texture2D *roughnessTextures = (Texture2D *)RL_CALLOC(data->images_count, sizeof(Texture2D));
+        Texture2D *metalnessTextures = (Texture2D *)RL_CALLOC(data->images_count, sizeof(Texture2D));
 
         // Load materials data
         //----------------------------------------------------------------------------------------------------
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -5551,12 +10282,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load base color texture (albedo)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
-                        UnloadImage(imAlbedo);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureGLTF(data, data->materials[i].pbr_metallic_roughness.base_color_texture.texture, images, textures);
                 }
                 // Load base color factor (tint)
                 model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
@@ -5567,9 +10293,13 @@ static Model LoadGLTF(const char *fileName)
                 // Load metallic/roughness texture
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
+                    cgltf_image *image = data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image;
+                    int index = (image != NULL)? (int)(image - data->images) : -1;
+
+                    // Split metallic/roughness channels into textures, once per image
+                    if ((index >= 0) && (roughnessTextures[index].id == 0) && (images[index].data != NULL))
                     {
+                        Image imMetallicRoughness = images[index];
                         Image imMetallic = { 0 };
                         Image imRoughness = { 0 };
 
@@ -5593,12 +10323,17 @@ static Model LoadGLTF(const char *fileName)
                             }
                         }
 
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imRoughness);
-                        model.materials[j].maps[MATERIAL_MAP_METALNESS].texture = LoadTextureFromImage(imMetallic);
+                        roughnessTextures[index] = LoadTextureFromImage(imRoughness);
+                        metalnessTextures[index] = LoadTextureFromImage(imMetallic);
 
                         UnloadImage(imRoughness);
                         UnloadImage(imMetallic);
-                        UnloadImage(imMetallicRoughness);
+                    }
+
+                    if (index >= 0)
+                    {
+                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = roughnessTextures[index];
+                        model.materials[j].maps[MATERIAL_MAP_METALNESS].texture = metalnessTextures[index];
                     }
 
                     // Load metallic/roughness material properties
@@ -5612,34 +10347,19 @@ static Model LoadGLTF(const char *fileName)
                 // Load normal texture
                 if (data->materials[i].normal_texture.texture)
                 {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
-                        UnloadImage(imNormal);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureGLTF(data, data->materials[i].normal_texture.texture, images, textures);
                 }
 
                 // Load ambient occlusion texture
                 if (data->materials[i].occlusion_texture.texture)
                 {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
-                        UnloadImage(imOcclusion);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureGLTF(data, data->materials[i].occlusion_texture.texture, images, textures);
                 }
 
                 // Load emissive texture
                 if (data->materials[i].emissive_texture.texture)
                 {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
-                        UnloadImage(imEmissive);
-                    }
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureGLTF(data, data->materials[i].emissive_texture.texture, images, textures);
 
                     // Load emissive color factor
                     model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
@@ -5652,492 +10372,14 @@ static Model LoadGLTF(const char *fileName)
             // Other possible materials not supported by raylib pipeline:
             // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
         }
-        //----------------------------------------------------------------------------------------------------
-
-        // Load meshes data
-        //
-        // NOTE: Visit each node in the hierarchy and process any mesh linked from it
-        //  - Each primitive within a glTF node becomes a raylib Mesh
-        //  - The local-to-world transform of each node is used to transform the points/normals/tangents of the created Mesh(es)
-        //  - Any glTF mesh linked from more than one Node (a.e. instancing) is turned into multiple Mesh's, as each Node will have its own transform applied
-        //
-        // WARNING: The code below disregards the scenes defined in the file, all nodes are used
-        //----------------------------------------------------------------------------------------------------
-        int meshIndex = 0;
-        for (unsigned int i = 0; i < data->nodes_count; i++)
-        {
-            cgltf_node *node = &(data->nodes[i]);
-
-            cgltf_mesh *mesh = node->mesh;
-            if (!mesh) continue;
-
-            cgltf_float worldTransform[16];
-            cgltf_node_transform_world(node, worldTransform);
-
-            Matrix worldMatrix = {
-                worldTransform[0], worldTransform[4], worldTransform[8], worldTransform[12],
-                worldTransform[1], worldTransform[5], worldTransform[9], worldTransform[13],
-                worldTransform[2], worldTransform[6], worldTransform[10], worldTransform[14],
-                worldTransform[3], worldTransform[7], worldTransform[11], worldTransform[15]
-            };
-
-            Matrix worldMatrixNormals = MatrixTranspose(MatrixInvert(worldMatrix));
-
-            for (unsigned int p = 0; p < mesh->primitives_count; p++)
-            {
-                // NOTE: Only support primitives defined by triangles
-                // Other alternatives: points, lines, line_strip, triangle_strip
-                if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
-
-                // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
-                // Only some formats for each attribute type are supported, read info at the top of this function!
-
-                for (unsigned int j = 0; j < mesh->primitives[p].attributes_count; j++)
-                {
-                    // Check the different attributes for every primitive
-                    if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION, vec3, float
-                    {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined
-
-                        if (model.meshes[meshIndex].vertices != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data already loaded", fileName);
-                        else
-                        {
-                            if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
-                            {
-                                // Init raylib mesh vertices to copy glTF attribute data
-                                model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                                model.meshes[meshIndex].vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load 3 components of float data type into mesh.vertices
-                                LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
-
-                                // Transform the vertices
-                                float *vertices = model.meshes[meshIndex].vertices;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k+1], vertices[3*k+2] }, worldMatrix);
-                                    vertices[3*k] = vt.x;
-                                    vertices[3*k+1] = vt.y;
-                                    vertices[3*k+2] = vt.z;
-                                }
-                            }
-                            else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_16u))
-                            {
-                                // Init raylib mesh vertices to copy glTF attribute data
-                                model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                                model.meshes[meshIndex].vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*3*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
-
-                                // Convert data to raylib vertex data type (float) the matrix will scale it to the correct size as a float
-                                for (unsigned int t = 0; t < attribute->count*3; t++) model.meshes[meshIndex].vertices[t] = (float)temp[t];
-
-                                RL_FREE(temp);
-
-                                // Transform the vertices
-                                float *vertices = model.meshes[meshIndex].vertices;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k + 1], vertices[3*k + 2] }, worldMatrix);
-                                    vertices[3*k] = vt.x;
-                                    vertices[3*k + 1] = vt.y;
-                                    vertices[3*k + 2] = vt.z;
-                                }
-                            }
-                            else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_16))
-                            {
-                                // Init raylib mesh vertices to copy glTF attribute data
-                                model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                                model.meshes[meshIndex].vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                short *temp = (short *)RL_MALLOC(attribute->count*3*sizeof(short));
-                                LOAD_ATTRIBUTE(attribute, 3, short, temp);
-
-                                // Convert data to raylib vertex data type (float) the matrix will scale it to the correct size as a float
-                                for (unsigned int t = 0; t < attribute->count*3; t++) model.meshes[meshIndex].vertices[t] = (float)temp[t];
-
-                                RL_FREE(temp);
-
-                                // Transform the vertices
-                                float *vertices = model.meshes[meshIndex].vertices;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k + 1], vertices[3*k + 2] }, worldMatrix);
-                                    vertices[3*k] = vt.x;
-                                    vertices[3*k + 1] = vt.y;
-                                    vertices[3*k + 2] = vt.z;
-                                }
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
-                        }
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_normal) // NORMAL, vec3, float
-                    {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if (model.meshes[meshIndex].normals != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Normals attribute data already loaded", fileName);
-                        else
-                        {
-                            if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
-                            {
-                                // Init raylib mesh normals to copy glTF attribute data
-                                model.meshes[meshIndex].normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load 3 components of float data type into mesh.normals
-                                LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
-
-                                // Transform the normals
-                                float *normals = model.meshes[meshIndex].normals;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 nt = Vector3Transform((Vector3){ normals[3*k], normals[3*k+1], normals[3*k+2] }, worldMatrixNormals);
-                                    normals[3*k] = nt.x;
-                                    normals[3*k+1] = nt.y;
-                                    normals[3*k+2] = nt.z;
-                                }
-                            }
-                            else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_16))
-                            {
-                                // Init raylib mesh normals to copy glTF attribute data
-                                model.meshes[meshIndex].normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                short *temp = (short *)RL_MALLOC(attribute->count*3*sizeof(short));
-                                LOAD_ATTRIBUTE(attribute, 3, short, temp);
-
-                                // Convert data to raylib normal data type (float)
-                                for (unsigned int t = 0; t < attribute->count*3; t++) model.meshes[meshIndex].normals[t] = (float)temp[t];
-
-                                RL_FREE(temp);
-
-                                // Transform the normals
-                                float *normals = model.meshes[meshIndex].normals;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 nt = Vector3Normalize(Vector3Transform((Vector3){ normals[3*k], normals[3*k + 1], normals[3*k + 2] }, worldMatrixNormals));
-                                    normals[3*k] = nt.x;
-                                    normals[3*k + 1] = nt.y;
-                                    normals[3*k + 2] = nt.z;
-                                }
-                            }
-                            else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_8u))
-                            {
-                                // Init raylib mesh normals to copy glTF attribute data
-                                model.meshes[meshIndex].normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*3*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
-
-                                // Convert data to raylib normal data type (float)
-                                for (unsigned int t = 0; t < attribute->count*3; t++) model.meshes[meshIndex].normals[t] = (float)temp[t];
-
-                                RL_FREE(temp);
-
-                                // Transform the normals
-                                float *normals = model.meshes[meshIndex].normals;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 nt = Vector3Normalize(Vector3Transform((Vector3){ normals[3*k], normals[3*k + 1], normals[3*k + 2] }, worldMatrixNormals));
-                                    normals[3*k] = nt.x;
-                                    normals[3*k + 1] = nt.y;
-                                    normals[3*k + 2] = nt.z;
-                                }
-                            }
-                            else if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_8))
-                            {
-                                // Init raylib mesh normals to copy glTF attribute data
-                                model.meshes[meshIndex].normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                char *temp = (char *)RL_MALLOC(attribute->count*3*sizeof(char));
-                                LOAD_ATTRIBUTE(attribute, 3, char, temp);
-
-                                // Convert data to raylib normal data type (float)
-                                for (unsigned int t = 0; t < attribute->count*3; t++) model.meshes[meshIndex].normals[t] = (float)temp[t];
-
-                                RL_FREE(temp);
-
-                                // Transform the normals
-                                float *normals = model.meshes[meshIndex].normals;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 nt = Vector3Normalize(Vector3Transform((Vector3){ normals[3*k], normals[3*k + 1], normals[3*k + 2] }, worldMatrixNormals));
-                                    normals[3*k] = nt.x;
-                                    normals[3*k + 1] = nt.y;
-                                    normals[3*k + 2] = nt.z;
-                                }
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Normals attribute data format not supported, use vec3 float", fileName);
-                        }
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_tangent) // TANGENT, vec4, float, w is tangent basis sign
-                    {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if (model.meshes[meshIndex].tangents != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Tangents attribute data already loaded", fileName);
-                        else
-                        {
-                            if ((attribute->type == cgltf_type_vec4) && (attribute->component_type == cgltf_component_type_r_32f))
-                            {
-                                // Init raylib mesh tangent to copy glTF attribute data
-                                model.meshes[meshIndex].tangents = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
-
-                                // Load 4 components of float data type into mesh.tangents
-                                LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
-
-                                // Transform the tangents
-                                float *tangents = model.meshes[meshIndex].tangents;
-                                for (unsigned int k = 0; k < attribute->count; k++)
-                                {
-                                    Vector3 tt = Vector3Transform((Vector3){ tangents[4*k], tangents[4*k+1], tangents[4*k+2] }, worldMatrix);
-                                    tangents[4*k] = tt.x;
-                                    tangents[4*k+1] = tt.y;
-                                    tangents[4*k+2] = tt.z;
-                                }
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangents attribute data format not supported, use vec4 float", fileName);
-                        }
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_n, vec2, float/u8n/u16n
-                    {
-                        // Support up to 2 texture coordinates attributes
-                        float *texcoordPtr = NULL;
 
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
+        for (unsigned int i = 0; i < data->images_count; i++) UnloadImage(images[i]);
 
-                        if (attribute->type == cgltf_type_vec2)
-                        {
-                            if (attribute->component_type == cgltf_component_type_r_32f) // vec2, float
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load 3 components of float data type into mesh.texcoords
-                                LOAD_ATTRIBUTE(attribute, 2, float, texcoordPtr)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_8u) // vec2, u8n
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*2*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 2, unsigned char, temp);
-
-                                // Convert data to raylib texcoord data type (float)
-                                for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/255.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u) // vec2, u16n
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*2*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 2, unsigned short, temp);
-
-                                // Convert data to raylib texcoord data type (float)
-                                for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/65535.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported", fileName);
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
-
-                        int index = mesh->primitives[p].attributes[j].index;
-                        if (index == 0) model.meshes[meshIndex].texcoords = texcoordPtr;
-                        else if (index == 1) model.meshes[meshIndex].texcoords2 = texcoordPtr;
-                        else
-                        {
-                            TRACELOG(LOG_WARNING, "MODEL: [%s] No more than 2 texture coordinates attributes supported", fileName);
-                            if (texcoordPtr != NULL) RL_FREE(texcoordPtr);
-                        }
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_color) // COLOR_n, vec3/vec4, float/u8n/u16n
-                    {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range
-
-                        if (model.meshes[meshIndex].colors != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Colors attribute data already loaded", fileName);
-                        else
-                        {
-                            if (attribute->type == cgltf_type_vec3) // RGB
-                            {
-                                if (attribute->component_type == cgltf_component_type_r_8u)
-                                {
-                                    // Init raylib mesh color to copy glTF attribute data
-                                    model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                    // Load data into a temp buffer to be converted to raylib data type
-                                    unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*3*sizeof(unsigned char));
-                                    LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
-
-                                    // Convert data to raylib color data type (4 bytes)
-                                    for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                    {
-                                        model.meshes[meshIndex].colors[c] = temp[k];
-                                        model.meshes[meshIndex].colors[c + 1] = temp[k + 1];
-                                        model.meshes[meshIndex].colors[c + 2] = temp[k + 2];
-                                        model.meshes[meshIndex].colors[c + 3] = 255;
-                                    }
-
-                                    RL_FREE(temp);
-                                }
-                                else if (attribute->component_type == cgltf_component_type_r_16u)
-                                {
-                                    // Init raylib mesh color to copy glTF attribute data
-                                    model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                    // Load data into a temp buffer to be converted to raylib data type
-                                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*3*sizeof(unsigned short));
-                                    LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
-
-                                    // Convert data to raylib color data type (4 bytes)
-                                    for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                    {
-                                        model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[k]/65535.0f)*255.0f);
-                                        model.meshes[meshIndex].colors[c + 1] = (unsigned char)(((float)temp[k + 1]/65535.0f)*255.0f);
-                                        model.meshes[meshIndex].colors[c + 2] = (unsigned char)(((float)temp[k + 2]/65535.0f)*255.0f);
-                                        model.meshes[meshIndex].colors[c + 3] = 255;
-                                    }
-
-                                    RL_FREE(temp);
-                                }
-                                else if (attribute->component_type == cgltf_component_type_r_32f)
-                                {
-                                    // Init raylib mesh color to copy glTF attribute data
-                                    model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                    // Load data into a temp buffer to be converted to raylib data type
-                                    float *temp = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-                                    LOAD_ATTRIBUTE(attribute, 3, float, temp);
-
-                                    // Convert data to raylib color data type (4 bytes)
-                                    for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                    {
-                                        model.meshes[meshIndex].colors[c] = (unsigned char)(temp[k]*255.0f);
-                                        model.meshes[meshIndex].colors[c + 1] = (unsigned char)(temp[k + 1]*255.0f);
-                                        model.meshes[meshIndex].colors[c + 2] = (unsigned char)(temp[k + 2]*255.0f);
-                                        model.meshes[meshIndex].colors[c + 3] = 255;
-                                    }
-
-                                    RL_FREE(temp);
-                                }
-                                else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                            }
-                            else if (attribute->type == cgltf_type_vec4) // RGBA
-                            {
-                                if (attribute->component_type == cgltf_component_type_r_8u)
-                                {
-                                    // Init raylib mesh color to copy glTF attribute data
-                                    model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                    // Load 4 components of unsigned char data type into mesh.colors
-                                    LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
-                                }
-                                else if (attribute->component_type == cgltf_component_type_r_16u)
-                                {
-                                    // Init raylib mesh color to copy glTF attribute data
-                                    model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                    // Load data into a temp buffer to be converted to raylib data type
-                                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                                    LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
-
-                                    // Convert data to raylib color data type (4 bytes)
-                                    for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
-
-                                    RL_FREE(temp);
-                                }
-                                else if (attribute->component_type == cgltf_component_type_r_32f)
-                                {
-                                    // Init raylib mesh color to copy glTF attribute data
-                                    model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                    // Load data into a temp buffer to be converted to raylib data type
-                                    float *temp = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
-                                    LOAD_ATTRIBUTE(attribute, 4, float, temp);
-
-                                    // Convert data to raylib color data type (4 bytes), color data must be normalized
-                                    for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
-
-                                    RL_FREE(temp);
-                                }
-                                else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                        }
-                    }
-
-                    // NOTE: Attributes related to animations data are processed after mesh data loading
-                }
-
-                // Load primitive indices data (if provided)
-                if ((mesh->primitives[p].indices != NULL) && (mesh->primitives[p].indices->buffer_view != NULL))
-                {
-                    cgltf_accessor *attribute = mesh->primitives[p].indices;
-
-                    model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
-
-                    if (model.meshes[meshIndex].indices != NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Indices attribute data already loaded", fileName);
-                    else
-                    {
-                        if (attribute->component_type == cgltf_component_type_r_16u)
-                        {
-                            // Init raylib mesh indices to copy glTF attribute data
-                            model.meshes[meshIndex].indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
-
-                            // Load unsigned short data type into mesh.indices
-                            LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
-                        }
-                        else if (attribute->component_type == cgltf_component_type_r_8u)
-                        {
-                            // Init raylib mesh indices to copy glTF attribute data
-                            model.meshes[meshIndex].indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
-                            LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned char, model.meshes[meshIndex].indices, unsigned short)
-
-                        }
-                        else if (attribute->component_type == cgltf_component_type_r_32u)
-                        {
-                            // Init raylib mesh indices to copy glTF attribute data
-                            model.meshes[meshIndex].indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
-                            LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned int, model.meshes[meshIndex].indices, unsigned short);
-
-                            TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
-                    }
-                }
-                else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
-
-                // Assign to the primitive mesh the corresponding material index
-                // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
-                for (unsigned int m = 0; m < data->materials_count; m++)
-                {
-                    // The primitive actually keeps the pointer to the corresponding material,
-                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
-                    // To get the index, check if material pointers match, and assign the corresponding index,
-                    // skipping index 0, the default material
-                    if (&data->materials[m] == mesh->primitives[p].material)
-                    {
-                        model.meshMaterial[meshIndex] = m + 1;
-                        break;
-                    }
-                }
-
-                meshIndex++;       // Move to next mesh
-            }
-        }
+        RL_FREE(images);
+        RL_FREE(imageUsed);
+        RL_FREE(textures);
+        RL_FREE(roughnessTextures);
+        RL_FREE(metalnessTextures);
         //----------------------------------------------------------------------------------------------------
 
         // Load animation data
@@ -6195,166 +10437,156 @@ static Model LoadGLTF(const char *fileName)
             if (data->skins_count > 1) TRACELOG(LOG_WARNING, "MODEL: [%s] can only load one skin (armature) per model, but gltf skins_count == %i", fileName, data->skins_count);
         }
 
-        meshIndex = 0;
-        for (unsigned int i = 0; i < data->nodes_count; i++)
+        for (int meshIndex = 0; meshIndex < model.meshCount; meshIndex++)
         {
-            cgltf_node *node = &(data->nodes[i]);
-
-            cgltf_mesh *mesh = node->mesh;
-            if (!mesh) continue;
+            cgltf_node *node = primitives[meshIndex].node;
+            cgltf_primitive *primitive = primitives[meshIndex].primitive;
+            bool hasJoints = false;
 
-            for (unsigned int p = 0; p < mesh->primitives_count; p++)
+            for (unsigned int j = 0; j < primitive->attributes_count; j++)
             {
-                bool hasJoints = false;
-
-                // NOTE: Only support primitives defined by triangles
-                if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
-
-                for (unsigned int j = 0; j < mesh->primitives[p].attributes_count; j++)
+                // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
+                if (primitive->attributes[j].type == cgltf_attribute_type_joints) // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
                 {
-                    // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
-                    if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_joints) // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
-                    {
-                        hasJoints = true;
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
+                    hasJoints = true;
+                    cgltf_accessor *attribute = primitive->attributes[j].data;
 
-                        // NOTE: JOINTS_n can only be vec4 and u8/u16
-                        // SPECS: https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#meshes-overview
+                    // NOTE: JOINTS_n can only be vec4 and u8/u16
+                    // SPECS: https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#meshes-overview
 
-                        // WARNING: raylib only supports model.meshes[].boneIndices as u8 (unsigned char),
-                        // if data is provided in any other format, it is converted to supported format but
-                        // it could imply data loss (a warning message is issued in that case)
+                    // WARNING: raylib only supports model.meshes[].boneIndices as u8 (unsigned char),
+                    // if data is provided in any other format, it is converted to supported format but
+                    // it could imply data loss (a warning message is issued in that case)
 
-                        if (attribute->type == cgltf_type_vec4)
+                    if (attribute->type == cgltf_type_vec4)
+                    {
+                        if (attribute->component_type == cgltf_component_type_r_8u)
                         {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh boneIndices to copy glTF attribute data
-                                model.meshes[meshIndex].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
+                            // Init raylib mesh boneIndices to copy glTF attribute data
+                            model.meshes[meshIndex].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
 
-                                // Load attribute: vec4, u8 (unsigned char)
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIndices)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh boneIndices to copy glTF attribute data
-                                model.meshes[meshIndex].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
+                            // Load attribute: vec4, u8 (unsigned char)
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIndices)
+                        }
+                        else if (attribute->component_type == cgltf_component_type_r_16u)
+                        {
+                            // Init raylib mesh boneIndices to copy glTF attribute data
+                            model.meshes[meshIndex].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
 
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+                            // Load data into a temp buffer to be converted to raylib data type
+                            unsigned short *temp = (unsigned short *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned short));
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
 
-                                // Convert data to raylib color data type (4 bytes)
-                                bool boneIdOverflowWarning = false;
-                                for (int b = 0; b < model.meshes[meshIndex].vertexCount*4; b++)
+                            // Convert data to raylib color data type (4 bytes)
+                            bool boneIdOverflowWarning = false;
+                            for (int b = 0; b < model.meshes[meshIndex].vertexCount*4; b++)
+                            {
+                                if ((temp[b] > 255) && !boneIdOverflowWarning)
                                 {
-                                    if ((temp[b] > 255) && !boneIdOverflowWarning)
-                                    {
-                                        TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format (u16) overflow", fileName);
-                                        boneIdOverflowWarning = true;
-                                    }
-
-                                    // Despite the possible overflow, convert data to unsigned char
-                                    model.meshes[meshIndex].boneIndices[b] = (unsigned char)temp[b];
+                                    TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format (u16) overflow", fileName);
+                                    boneIdOverflowWarning = true;
                                 }
 
-                                RL_FREE(temp);
+                                // Despite the possible overflow, convert data to unsigned char
+                                model.meshes[meshIndex].boneIndices[b] = (unsigned char)temp[b];
                             }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported", fileName);
+
+                            RL_FREE(temp);
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported", fileName);
                     }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_weights) // WEIGHTS_n (vec4, u8n/u16n/f32)
-                    {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported", fileName);
+                }
+                else if (primitive->attributes[j].type == cgltf_attribute_type_weights) // WEIGHTS_n (vec4, u8n/u16n/f32)
+                {
+                    cgltf_accessor *attribute = primitive->attributes[j].data;
 
-                        if (attribute->type == cgltf_type_vec4)
+                    if (attribute->type == cgltf_type_vec4)
+                    {
+                        if (attribute->component_type == cgltf_component_type_r_8u)
                         {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh bone weight to copy glTF attribute data
-                                model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
+                            // Init raylib mesh bone weight to copy glTF attribute data
+                            model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
 
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned char, temp);
+                            // Load data into a temp buffer to be converted to raylib data type
+                            unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, temp);
 
-                                // Convert data to raylib bone weight data type (4 bytes)
-                                for (unsigned int b = 0; b < attribute->count*4; b++) model.meshes[meshIndex].boneWeights[b] = (float)temp[b]/255.0f;
+                            // Convert data to raylib bone weight data type (4 bytes)
+                            for (unsigned int b = 0; b < attribute->count*4; b++) model.meshes[meshIndex].boneWeights[b] = (float)temp[b]/255.0f;
 
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh bone weight to copy glTF attribute data
-                                model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
+                            RL_FREE(temp);
+                        }
+                        else if (attribute->component_type == cgltf_component_type_r_16u)
+                        {
+                            // Init raylib mesh bone weight to copy glTF attribute data
+                            model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
 
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+                            // Load data into a temp buffer to be converted to raylib data type
+                            unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*4*sizeof(unsigned short));
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
 
-                                // Convert data to raylib bone weight data type
-                                for (unsigned int b = 0; b < attribute->count*4; b++) model.meshes[meshIndex].boneWeights[b] = (float)temp[b]/65535.0f;
+                            // Convert data to raylib bone weight data type
+                            for (unsigned int b = 0; b < attribute->count*4; b++) model.meshes[meshIndex].boneWeights[b] = (float)temp[b]/65535.0f;
 
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_32f)
-                            {
-                                // Init raylib mesh bone weight to copy glTF attribute data
-                                model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
-
-                                // Load 4 components of float data type into mesh.boneWeights
-                                // for cgltf_attribute_type_weights:
-                                //   - data.meshes[0] (256 vertices)
-                                //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
-                                LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
+                            RL_FREE(temp);
+                        }
+                        else if (attribute->component_type == cgltf_component_type_r_32f)
+                        {
+                            // Init raylib mesh bone weight to copy glTF attribute data
+                            model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
+
+                            // Load 4 components of float data type into mesh.boneWeights
+                            // for cgltf_attribute_type_weights:
+                            //   - data.meshes[0] (256 vertices)
+                            //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
+                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
                     }
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
                 }
+            }
 
-                // Check if animated, and the mesh was not given any bone assignments, but is the child of a bone node
-                // in this case, all the verts need to be attached to the parent bone so it will animate with the bone
-                if ((data->skins_count > 0) && !hasJoints && (node->parent != NULL) && (node->parent->mesh == NULL))
+            // Check if animated, and the mesh was not given any bone assignments, but is the child of a bone node
+            // in this case, all the verts need to be attached to the parent bone so it will animate with the bone
+            if ((data->skins_count > 0) && !hasJoints && (node->parent != NULL) && (node->parent->mesh == NULL))
+            {
+                int parentBoneId = -1;
+                for (unsigned int joint = 0; joint < model.skeleton.boneCount; joint++)
                 {
-                    int parentBoneId = -1;
-                    for (unsigned int joint = 0; joint < model.skeleton.boneCount; joint++)
+                    if (data->skins[0].joints[joint] == node->parent)
                     {
-                        if (data->skins[0].joints[joint] == node->parent)
-                        {
-                            parentBoneId = joint;
-                            break;
-                        }
+                        parentBoneId = joint;
+                        break;
                     }
+                }
 
-                    if (parentBoneId >= 0)
-                    {
-                        model.meshes[meshIndex].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
-                        model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
+                if (parentBoneId >= 0)
+                {
+                    model.meshes[meshIndex].boneIndices = (unsigned char *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
+                    model.meshes[meshIndex].boneWeights = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
 
-                        for (int vertexIndex = 0; vertexIndex < model.meshes[meshIndex].vertexCount*4; vertexIndex += 4)
-                        {
-                            model.meshes[meshIndex].boneIndices[vertexIndex] = (unsigned char)parentBoneId;
-                            model.meshes[meshIndex].boneWeights[vertexIndex] = 1.0f;
-                        }
+                    for (int vertexIndex = 0; vertexIndex < model.meshes[meshIndex].vertexCount*4; vertexIndex += 4)
+                    {
+                        model.meshes[meshIndex].boneIndices[vertexIndex] = (unsigned char)parentBoneId;
+                        model.meshes[meshIndex].boneWeights[vertexIndex] = 1.0f;
                     }
                 }
+            }
 
 #if !SUPPORT_GPU_SKINNING
-                // Animated vertex data (CPU skinning)
-                model.meshes[meshIndex].animVertices = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
-                memcpy(model.meshes[meshIndex].animVertices, model.meshes[meshIndex].vertices, model.meshes[meshIndex].vertexCount*3*sizeof(float));
-                model.meshes[meshIndex].animNormals = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
-                if (model.meshes[meshIndex].normals != NULL) memcpy(model.meshes[meshIndex].animNormals, model.meshes[meshIndex].normals, model.meshes[meshIndex].vertexCount*3*sizeof(float));
+            // Animated vertex data (CPU skinning)
+            model.meshes[meshIndex].animVertices = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
+            memcpy(model.meshes[meshIndex].animVertices, model.meshes[meshIndex].vertices, model.meshes[meshIndex].vertexCount*3*sizeof(float));
+            model.meshes[meshIndex].animNormals = (float *)RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
+            if (model.meshes[meshIndex].normals != NULL) memcpy(model.meshes[meshIndex].animNormals, model.meshes[meshIndex].normals, model.meshes[meshIndex].vertexCount*3*sizeof(float));
 #endif
-                model.meshes[meshIndex].boneCount = model.skeleton.boneCount;
-
-                meshIndex++; // Move to next mesh
-            }
+            model.meshes[meshIndex].boneCount = model.skeleton.boneCount;
         }
 
+        RL_FREE(primitives);
+
         // Initialize runtime animation data: current pose and bone matrices
         model.currentPose = (Transform *)RL_CALLOC(model.skeleton.boneCount, sizeof(Transform));
         model.boneMatrices = (Matrix *)RL_CALLOC(model.skeleton.boneCount, sizeof(Matrix));
@@ -23,6 +23,17 @@
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 *           drawing text and shapes with a single draw call [SetShapesTexture()]
 *
+*       #define MAX_TEXT_GLYPHS_RUN       256
+*           Text drawing functions glyphs quads buffer size, glyphs are drawn by runs [DrawTextEx()]
+*
+*       #define FONT_CACHE_GLYPHS_MAX    1024
+*           Dynamic fonts [LoadFontDynamic()] maximum glyphs loaded at once, least recently used glyph
+*           is evicted when no glyph slot or font atlas space is available
+*
+*       #define FONT_CACHE_ATLAS_SIZE     256
+*       #define FONT_CACHE_ATLAS_MAX_SIZE 2048
+*           Dynamic fonts atlas initial and maximum size, atlas grows (doubling width or height) when required
+*
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
 *       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation
@@ -57,6 +68,10 @@
 
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
 
+#if SUPPORT_TEXT_THREADING
+    #include "utils.h"      // Required for: RunParallelTasks()
+#endif
+
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf(), snprintf()
 #include <string.h>         // Required for: strcmp(), strstr(), strncpy(), sscanf() [Used in LoadBMFont()]
@@ -108,6 +123,10 @@
     #define MAX_TEXTSPLIT_COUNT         128         // Maximum number of substrings to split: TextSplit()
 #endif
 
+#ifndef MAX_TEXT_GLYPHS_RUN
+    #define MAX_TEXT_GLYPHS_RUN         256         // Maximum glyphs quads drawn at once: DrawTextEx(), DrawTextCodepoints()
+#endif
+
 #ifndef FONT_ATLAS_CORNER_REC_SIZE
     // On font atlas image generation [GenImageFontAtlas()], add a 3x3 pixels white rectangle
     // at the bottom-right corner of the atlas. It can be useful for shapes drawing, to allow
@@ -115,10 +134,94 @@
     #define FONT_ATLAS_CORNER_REC_SIZE    3         // Size of white rectangle drawn on font atlas on font loading
 #endif
 
+#ifndef MAX_TEXT_THREADS
+    #define MAX_TEXT_THREADS              4         // Maximum threads used to rasterize font glyphs (calling thread included)
+#endif
+#ifndef FONT_THREAD_MIN_GLYPHS
+    #define FONT_THREAD_MIN_GLYPHS       32         // Minimum font glyphs per thread to split glyphs rasterization
+#endif
+
+#ifndef FONT_CACHE_GLYPHS_MAX
+    #define FONT_CACHE_GLYPHS_MAX      1024         // Dynamic font maximum glyphs loaded at once (least recently used evicted)
+#endif
+#ifndef FONT_CACHE_ATLAS_SIZE
+    #define FONT_CACHE_ATLAS_SIZE       256         // Dynamic font atlas initial size (width and height)
+#endif
+#ifndef FONT_CACHE_ATLAS_MAX_SIZE
+    #define FONT_CACHE_ATLAS_MAX_SIZE  2048         // Dynamic font atlas maximum size (width and height)
+#endif
+
+#define GLYPH_INDEX_PAGE_SIZE         256         // Glyphs lookup page size (codepoints), direct lookup
+#define GLYPH_INDEX_PAGE_COUNT        256         // Glyphs lookup pages, Basic Multilingual Plane (U+0000..U+FFFF)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Glyph lookup entry, codepoints out of direct lookup pages range
+typedef struct GlyphIndexEntry {
+    int codepoint;              // Character value (Unicode)
+    int glyph;                  // Glyph index in font
+} GlyphIndexEntry;
+
+#if SUPPORT_FILEFORMAT_TTF
+// Font glyphs rasterization task, glyphs processed: first, first + step, first + 2*step...
+typedef struct FontGlyphsTask {
+    stbtt_fontinfo fontInfo;    // Font info for glyphs rasterization, a copy per task
+    GlyphInfo *glyphs;          // Glyphs to rasterize (codepoint values defined)
+    int glyphCount;             // Number of glyphs
+    int first;                  // First glyph processed by task
+    int step;                   // Step between glyphs processed by task
+    float scaleFactor;          // Font scale factor for font size
+    int ascent;                 // Font ascent (baseline), unscaled
+    int fontSize;               // Font size (pixels height)
+    int type;                   // Font type (FontType)
+} FontGlyphsTask;
+
+// Font face data, shared by dynamic fonts of different sizes
+typedef struct FontFace {
+    unsigned char *fileData;    // Font file data (TTF/OTF), required by stb_truetype while in use
+    stbtt_fontinfo info;        // Font info for glyphs rasterization
+    int refCount;               // Number of dynamic fonts using the face
+} FontFace;
+#else
+typedef struct FontFace FontFace;
+#endif
+
+// Font atlas shelf, glyphs packed from left to right
+typedef struct FontCacheShelf {
+    int y;                      // Shelf position Y in atlas
+    int height;                 // Shelf height
+    int width;                  // Shelf used width
+} FontCacheShelf;
+
+// Dynamic font glyphs cache, glyphs rasterized on first use
+// NOTE: Font glyphs and recs arrays are glyph slots (font.glyphCount), slots are reused on eviction
+typedef struct FontCache {
+    FontFace *face;             // Font face data (shared)
+    float scale;                // Font scale factor for font size
+    int ascent;                 // Font ascent for font size (baseline)
+    Image atlas;                // Font atlas image (gray-alpha), kept in RAM for atlas growth
+    Texture2D texture;          // Font atlas texture, resized on atlas growth (same id)
+    FontCacheShelf *shelves;    // Font atlas shelves
+    int shelfCount;             // Number of shelves
+    int shelfCapacity;          // Shelves allocated capacity
+    Rectangle *areas;           // Glyphs slots atlas space (padding included), kept on glyph eviction
+    unsigned int *glyphsUse;    // Glyphs slots last use, used to evict least recently used glyph
+    unsigned int useCounter;    // Glyphs use counter, incremented on glyph loading
+    int slotCount;              // Number of glyph slots in use
+} FontCache;
+
+// Glyphs lookup by codepoint
+// NOTE: Basic Multilingual Plane codepoints use direct lookup pages (allocated on use),
+// other codepoints are binary searched in entries sorted by codepoint
+struct rGlyphIndex {
+    int *pages[GLYPH_INDEX_PAGE_COUNT]; // Direct lookup pages, glyph index + 1 (0: not available)
+    GlyphIndexEntry *entries;   // Codepoints out of pages range, sorted
+    int entryCount;             // Number of entries
+    int entryCapacity;          // Entries allocated capacity
+    int fallback;               // Fallback glyph index for not available codepoints ('?')
+    FontCache *cache;           // Dynamic font glyphs cache (NULL: glyphs loaded at once)
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -144,6 +247,26 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if SUPPORT_FILEFORMAT_BDF
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, const int *codepoints, int codepointCount, int *outFontSize);
 #endif
+#if SUPPORT_FILEFORMAT_TTF
+static void LoadFontGlyphs(void *data);            // Rasterize font glyphs (FontGlyphsTask)
+#endif
+
+static rGlyphIndex *LoadGlyphIndex(const GlyphInfo *glyphs, int glyphCount); // Load glyphs lookup by codepoint
+static void UnloadGlyphIndex(rGlyphIndex *index);  // Unload glyphs lookup
+static void AddGlyphIndex(rGlyphIndex *index, int codepoint, int glyph); // Add glyph to lookup, first glyph added for a codepoint is kept
+static int FindGlyphIndex(const rGlyphIndex *index, int codepoint); // Find glyph in lookup, returns -1 if not available
+#if SUPPORT_FILEFORMAT_TTF
+static void RemoveGlyphIndex(rGlyphIndex *index, int codepoint); // Remove glyph from lookup
+static Font LoadFontCache(FontFace *face, int fontSize); // Load dynamic font for a font face and size
+static bool LoadFontCacheArea(FontCache *cache, int width, int height, Rectangle *area); // Load font atlas space (shelf packing), atlas grown if required
+static bool GrowFontCacheAtlas(FontCache *cache);   // Grow font atlas (double width or height), glyphs keep atlas position
+#endif
+static void UnloadFontCache(FontCache *cache);      // Unload dynamic font glyphs cache, font face released when not used
+static int LoadFontCacheGlyph(Font font, int codepoint); // Load dynamic font glyph (rasterized), returns -1 if no space available
+static bool IsFontCacheMiss(Font font, int codepoint); // Check if dynamic font glyph for codepoint is not loaded yet
+static Texture2D GetFontTexture(Font font);        // Get font atlas texture, dynamic font atlas texture size could change
+static void GetGlyphQuad(Font font, int index, Vector2 position, float scaleFactor, float *vertices, float *texcoords); // Get glyph quad vertices and texcoords (4 vertices), glyph padding considered
+static void DrawTextGlyphs(Texture2D texture, const float *vertices, const float *texcoords, int glyphCount, Color tint); // Draw glyphs quads at once
 
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
@@ -311,6 +434,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphIndex = LoadGlyphIndex(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -322,9 +446,11 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphIndex(defaultFont.glyphIndex);
     defaultFont.glyphCount = 0;
     defaultFont.glyphs = NULL;
     defaultFont.recs = NULL;
+    defaultFont.glyphIndex = NULL;
 }
 
 // Get the default font
@@ -526,6 +652,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphIndex = LoadGlyphIndex(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -566,7 +693,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     {
         font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 1);
         font.texture = LoadTextureFromImage(atlas);
 
         // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
@@ -578,6 +705,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        font.glyphIndex = LoadGlyphIndex(font.glyphs, font.glyphCount);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else
@@ -593,6 +722,83 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font for dynamic glyphs loading, glyphs are rasterized on first use into font atlas
+// NOTE: Font atlas grows when required (font.texture id is kept, size could change), least recently used glyphs evicted when full
+Font LoadFontDynamic(const char *fileName, int fontSize)
+{
+    Font font = { 0 };
+
+    // Loading file to memory
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize);
+
+        UnloadFileData(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied, it's kept while font face is in use
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize)
+{
+    Font font = { 0 };
+
+#if SUPPORT_FILEFORMAT_TTF
+    char fileExtLower[16] = { 0 };
+    snprintf(fileExtLower, 16, "%s", TextToLower(fileType));
+
+    if ((fileData != NULL) && (dataSize > 0) &&
+        (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")))
+    {
+        FontFace *face = (FontFace *)RL_CALLOC(1, sizeof(FontFace));
+        face->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(face->fileData, fileData, dataSize);
+
+        if (stbtt_InitFont(&face->info, face->fileData, 0)) font = LoadFontCache(face, fontSize);
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+
+            RL_FREE(face->fileData);
+            RL_FREE(face);
+        }
+    }
+#endif
+
+    if (font.glyphs != NULL) TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %i glyphs max)", font.baseSize, font.glyphCount);
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: Font is not supported by LoadFontDynamic/LoadFontDynamicFromMemory, reverted to default font");
+        font = GetFontDefault();
+    }
+
+    return font;
+}
+
+// Load dynamic font with other size, font face data shared with provided dynamic font
+Font LoadFontDynamicSize(Font font, int fontSize)
+{
+    Font sizedFont = { 0 };
+
+#if SUPPORT_FILEFORMAT_TTF
+    if ((font.glyphIndex != NULL) && (font.glyphIndex->cache != NULL)) sizedFont = LoadFontCache(font.glyphIndex->cache->face, fontSize);
+    else
+#endif
+    {
+        TRACELOG(LOG_WARNING, "FONT: Provided font is not a dynamic font, reverted to default font");
+        sizedFont = GetFontDefault();
+    }
+
+    return sizedFont;
+}
+
 // Check if font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool IsFontValid(Font font)
@@ -672,109 +878,48 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
             glyphs = (GlyphInfo *)RL_CALLOC(glyphCounter, sizeof(GlyphInfo));
             glyphCounter = 0; // Reset to reuse
 
-            int k = 0;
+            // NOTE: Only storing glyphs for codepoints found in the font
+            // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
             for (int i = 0; i < codepointCount; i++)
             {
-                int cpWidth = 0, cpHeight = 0;   // Codepoint width and height (on generation)
-                int cp = requiredCodepoints[i];  // Codepoint value to get info for
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into a provided bitmap
-
-                // Check if glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, cp);
-
-                if (index > 0)
+                if (stbtt_FindGlyphIndex(&fontInfo, requiredCodepoints[i]) > 0)
                 {
-                    // NOTE: Only storing glyphs for codepoints found in the font
-                    glyphs[k].value = cp;
-
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP:
-                        {
-                            glyphs[k].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, cp,
-                                &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
-                        } break;
-                        case FONT_SDF:
-                        {
-                            if (cp != 32)
-                            {
-                                glyphs[k].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, cp,
-                                    FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
-                                    &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
-                            }
-                        } break;
-                        //case FONT_MSDF:
-                        default: break;
-                    }
-
-                    if (glyphs[k].image.data != NULL) // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, cp, &glyphs[k].advanceX, NULL);
-                        glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
-
-                        // WARNING: If requested SDF font, sdf-glyph height is definitely bigger than fontSize due to FONT_SDF_CHAR_PADDING
-                        if ((type != FONT_SDF) && (cpHeight > fontSize)) TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph height is bigger than requested font size: %i > %i", cp, cpHeight, (int)fontSize);
-
-                        // Load glyph image
-                        glyphs[k].image.width = cpWidth;
-                        glyphs[k].image.height = cpHeight;
-                        glyphs[k].image.mipmaps = 1;
-                        glyphs[k].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        glyphs[k].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-                    //else TRACELOG(LOG_WARNING, "FONT: Glyph [0x%08x] has no image data available", cp); // Only reported for 0x20 and 0x3000
-
-                    // Create an empty image for Space character (0x20), useful for sprite font generation
-                    // NOTE: Another space to consider: 0x3000 (CJK - Ideographic Space)
-                    if ((cp == 0x20) || (cp == 0x3000))
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, cp, &glyphs[k].advanceX, NULL);
-                        glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = NULL,
-                            .width = glyphs[k].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        // Only allocate space image if required
-                        if (glyphs[k].advanceX > 0) imSpace.data = RL_CALLOC(glyphs[k].advanceX*fontSize, 1);
-                        else glyphs[k].advanceX = 0;
-
-                        glyphs[k].image = imSpace;
-                    }
-
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < cpWidth*cpHeight; p++)
-                        {
-                            if (((unsigned char *)glyphs[k].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD)
-                                ((unsigned char *)glyphs[k].image.data)[p] = 0;
-                            else ((unsigned char *)glyphs[k].image.data)[p] = 255;
-                        }
-                    }
-
-                    k++;
+                    glyphs[glyphCounter].value = requiredCodepoints[i];
                     glyphCounter++;
                 }
-                else
-                {
-                    // WARNING: Glyph not found on font, optionally use a fallback glyph
-                }
             }
 
-            if (glyphCounter < codepointCount) TRACELOG(LOG_WARNING, "FONT: Requested codepoints glyphs found: [%i/%i]", k, codepointCount);
+            // Rasterize glyphs, work split between worker threads (glyphs interleaved, similar cost per thread)
+            // NOTE: Every task uses its own font info copy
+            FontGlyphsTask tasks[MAX_TEXT_THREADS] = { 0 };
+            int taskCount = 1;
+
+#if SUPPORT_TEXT_THREADING
+            taskCount = glyphCounter/FONT_THREAD_MIN_GLYPHS;
+            if (taskCount > MAX_TEXT_THREADS) taskCount = MAX_TEXT_THREADS;
+            if (taskCount < 1) taskCount = 1;
+#endif
+            for (int t = 0; t < taskCount; t++)
+            {
+                tasks[t].fontInfo = fontInfo;
+                tasks[t].glyphs = glyphs;
+                tasks[t].glyphCount = glyphCounter;
+                tasks[t].first = t;
+                tasks[t].step = taskCount;
+                tasks[t].scaleFactor = scaleFactor;
+                tasks[t].ascent = ascent;
+                tasks[t].fontSize = fontSize;
+                tasks[t].type = type;
+            }
+
+#if SUPPORT_TEXT_THREADING
+            if (taskCount > 1) RunParallelTasks(LoadFontGlyphs, tasks, taskCount, sizeof(FontGlyphsTask));
+            else LoadFontGlyphs(&tasks[0]);
+#else
+            LoadFontGlyphs(&tasks[0]);
+#endif
+
+            if (glyphCounter < codepointCount) TRACELOG(LOG_WARNING, "FONT: Requested codepoints glyphs found: [%i/%i]", glyphCounter, codepointCount);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -810,19 +955,24 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     // Calculate image size based on total glyph width and glyph row count
     int totalWidth = 0;
     int maxGlyphWidth = 0;
+    float glyphsArea = 0.0f;        // Glyphs area, padding included (atlas occupancy)
 
     for (int i = 0; i < glyphCount; i++)
     {
         if (glyphs[i].image.width > maxGlyphWidth) maxGlyphWidth = glyphs[i].image.width;
         totalWidth += glyphs[i].image.width + 2*padding;
+        glyphsArea += (float)(glyphs[i].image.width + 2*padding)*(glyphs[i].image.height + 2*padding);
     }
 
     int paddedFontSize = fontSize + 2*padding;
 
     // Estimate image atlas size from available data
     // NOTE: Multiplying total expected area by 1.2f scale factor but in case
-    // some glyphs do not fit, the atlas height is scaled x2 to fit them
-    float totalArea = totalWidth*paddedFontSize*1.2f;
+    // some glyphs do not fit, the atlas height is scaled x2 to fit them,
+    // skyline packing uses glyphs area (glyphs sorted by height, less space wasted)
+    float totalArea = (packMethod == 1)? glyphsArea*1.1f : totalWidth*paddedFontSize*1.2f;
+    if (totalArea < (float)(maxGlyphWidth + 2*padding)*(maxGlyphWidth + 2*padding)) totalArea = (float)(maxGlyphWidth + 2*padding)*(maxGlyphWidth + 2*padding);
+    if (totalArea < 16.0f) totalArea = 16.0f;
     float imageMinSize = sqrtf(totalArea);
     int imageSize = (int)powf(2, ceilf(logf(imageMinSize)/logf(2)));
 
@@ -909,11 +1059,11 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     }
     else if (packMethod == 1) // Use Skyline rect packing algorithm (stb_pack_rect)
     {
+        // NOTE: Rectangles are packed sorted by height [stbrp_pack_rects()], in case some glyphs
+        // do not fit, atlas size is doubled (width or height) and rectangles packed again
         stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
-        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
-
-        stbrp_init_target(context, atlas.width, atlas.height, nodes, glyphCount);
         stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
+        stbrp_node *nodes = NULL;
 
         // Fill rectangles for packaging
         for (int i = 0; i < glyphCount; i++)
@@ -923,8 +1073,37 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             rects[i].h = glyphs[i].image.height + 2*padding;
         }
 
-        // Package rectangles into atlas
-        stbrp_pack_rects(context, rects, glyphCount);
+        int atlasWidth = atlas.width;
+        int atlasHeight = atlas.height;
+        bool packed = false;
+
+        while (!packed)
+        {
+            // Package rectangles into atlas, a node per atlas pixel column (no width quantization)
+            // NOTE: Atlas bottom rows are reserved for the white rectangle at the bottom-right corner
+            nodes = (stbrp_node *)RL_REALLOC(nodes, atlasWidth*sizeof(*nodes));
+            stbrp_init_target(context, atlasWidth, atlasHeight - FONT_ATLAS_CORNER_REC_SIZE, nodes, atlasWidth);
+            packed = (stbrp_pack_rects(context, rects, glyphCount) == 1);
+
+            if (!packed)
+            {
+                // WARNING: Atlas size limited to 16384x16384 (common GPU maximum texture size)
+                if ((atlasWidth <= atlasHeight) && (atlasWidth < 16384)) atlasWidth *= 2;
+                else if (atlasHeight < 16384) atlasHeight *= 2;
+                else break;
+            }
+        }
+
+        if ((atlasWidth != atlas.width) || (atlasHeight != atlas.height))
+        {
+            TRACELOG(LOG_DEBUG, "FONT: Updating atlas size to fit all characters");
+
+            RL_FREE(atlas.data);
+            atlas.width = atlasWidth;
+            atlas.height = atlasHeight;
+            atlasDataSize = atlas.width*atlas.height;
+            atlas.data = (unsigned char *)RL_CALLOC(atlasDataSize, 1);
+        }
 
         for (int i = 0; i < glyphCount; i++)
         {
@@ -936,21 +1115,11 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
 
             if (rects[i].was_packed)
             {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
+                // Copy pixel data from glyph image to atlas, packed rectangle is inside atlas
+                for (int y = 0; (y < glyphs[i].image.height) && (glyphs[i].image.data != NULL); y++)
                 {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        int destX = rects[i].x + padding + x;
-                        int destY = rects[i].y + padding + y;
-
-                        // Security fix: check both lower and upper bounds
-                        if (destX >= 0 && destX < atlas.width && destY >= 0 && destY < atlas.height)
-                        {
-                            ((unsigned char *)atlas.data)[destY*atlas.width + destX] =
-                                ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                        }
-                    }
+                    memcpy((unsigned char *)atlas.data + (rects[i].y + padding + y)*atlas.width + rects[i].x + padding,
+                        (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width, glyphs[i].image.width);
                 }
             }
             else TRACELOG(LOG_WARNING, "FONT: Failed to package glyph (0x%02x)", glyphs[i].value);
@@ -961,6 +1130,8 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
         RL_FREE(context);
     }
 
+    TRACELOG(LOG_INFO, "FONT: Font atlas generated (%ix%i | %i glyphs | %.1f%% occupancy)", atlas.width, atlas.height, glyphCount, 100.0f*glyphsArea/(float)(atlas.width*atlas.height));
+
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
     // useful to use as the white texture to draw shapes with raylib
     // Security: ensure the atlas is large enough to hold a 3x3 rectangle
@@ -1012,8 +1183,13 @@ void UnloadFont(Font font)
     if (font.texture.id != GetFontDefault().texture.id)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
-        UnloadTexture(font.texture);
+
+        // NOTE: Dynamic font atlas texture is owned by font cache (font.texture size could be outdated)
+        if ((font.glyphIndex != NULL) && (font.glyphIndex->cache != NULL)) UnloadFontCache(font.glyphIndex->cache);
+        else UnloadTexture(font.texture);
+
         RL_FREE(font.recs);
+        UnloadGlyphIndex(font.glyphIndex);
 
         TRACELOG(LOG_DEBUG, "FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1034,7 +1210,7 @@ bool ExportFontAsCode(Font font, const char *fileName)
 
     // Get font atlas image and size, required to estimate code file size
     // NOTE: This mechanism is highly coupled to raylib
-    Image image = LoadImageFromTexture(font.texture);
+    Image image = LoadImageFromTexture(GetFontTexture(font));
     if (image.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) TRACELOG(LOG_WARNING, "Font export as code: Font image format is not GRAY+ALPHA!");
     int imageDataSize = GetPixelDataSize(image.width, image.height, image.format);
 
@@ -1206,10 +1382,11 @@ void DrawText(const char *text, int posX, int posY, int fontSize, Color color)
 }
 
 // Draw text using Font
-// NOTE: chars spacing is NOT proportional to fontSize
+// NOTE: chars spacing is NOT proportional to fontSize, glyphs quads are drawn by runs
 void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
     if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    font.texture = GetFontTexture(font);
 
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
@@ -1218,12 +1395,27 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    float vertices[MAX_TEXT_GLYPHS_RUN*4*2];            // Glyphs run quads vertices (XY)
+    float texcoords[MAX_TEXT_GLYPHS_RUN*4*2];           // Glyphs run quads texcoords (UV)
+    int glyphCount = 0;
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
         int codepointByteCount = 0;
         int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
-        int index = GetGlyphIndex(font, codepoint);
+        int index = 0;
+
+        if (IsFontCacheMiss(font, codepoint))
+        {
+            // Dynamic font glyph loaded on first use, font atlas could change: glyphs run drawn before
+            DrawTextGlyphs(font.texture, vertices, texcoords, glyphCount, tint);
+            glyphCount = 0;
+
+            index = GetGlyphIndex(font, codepoint);
+            font.texture = GetFontTexture(font);
+        }
+        else index = GetGlyphIndex(font, codepoint);
 
         if (codepoint == '\n')
         {
@@ -1235,7 +1427,14 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                GetGlyphQuad(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, scaleFactor, &vertices[glyphCount*8], &texcoords[glyphCount*8]);
+                glyphCount++;
+
+                if (glyphCount == MAX_TEXT_GLYPHS_RUN)
+                {
+                    DrawTextGlyphs(font.texture, vertices, texcoords, glyphCount, tint);
+                    glyphCount = 0;
+                }
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1244,6 +1443,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    DrawTextGlyphs(font.texture, vertices, texcoords, glyphCount, tint);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1266,35 +1467,43 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: Considering glyph padding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+    font.texture = GetFontTexture(font);
 
-    // Character source rectangle from font texture atlas
-    // NOTE: Considering glyphs padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+    float vertices[4*2] = { 0 };
+    float texcoords[4*2] = { 0 };
 
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    GetGlyphQuad(font, index, position, fontSize/font.baseSize, vertices, texcoords);
+    DrawTextGlyphs(font.texture, vertices, texcoords, 1, tint);
 }
 
 // Draw multiple characters (codepoints)
 void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint)
 {
+    font.texture = GetFontTexture(font);
+
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    float vertices[MAX_TEXT_GLYPHS_RUN*4*2];            // Glyphs run quads vertices (XY)
+    float texcoords[MAX_TEXT_GLYPHS_RUN*4*2];           // Glyphs run quads texcoords (UV)
+    int glyphCount = 0;
+
     for (int i = 0; i < codepointCount; i++)
     {
-        int index = GetGlyphIndex(font, codepoints[i]);
+        int index = 0;
+
+        if (IsFontCacheMiss(font, codepoints[i]))
+        {
+            // Dynamic font glyph loaded on first use, font atlas could change: glyphs run drawn before
+            DrawTextGlyphs(font.texture, vertices, texcoords, glyphCount, tint);
+            glyphCount = 0;
+
+            index = GetGlyphIndex(font, codepoints[i]);
+            font.texture = GetFontTexture(font);
+        }
+        else index = GetGlyphIndex(font, codepoints[i]);
 
         if (codepoints[i] == '\n')
         {
@@ -1306,13 +1515,110 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
         {
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                GetGlyphQuad(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, scaleFactor, &vertices[glyphCount*8], &texcoords[glyphCount*8]);
+                glyphCount++;
+
+                if (glyphCount == MAX_TEXT_GLYPHS_RUN)
+                {
+                    DrawTextGlyphs(font.texture, vertices, texcoords, glyphCount, tint);
+                    glyphCount = 0;
+                }
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    DrawTextGlyphs(font.texture, vertices, texcoords, glyphCount, tint);
+}
+
+// Load text layout, glyphs quads generated once for drawing (static text)
+// NOTE: Quads are relative to text position, layout references font texture (font must not be unloaded),
+// dynamic font layout is valid while font atlas does not change (glyphs loaded or evicted)
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((text == NULL) || !IsFontValid(font)) return layout;
+
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+    int capacity = GetCodepointCount(text);
+
+    if ((font.glyphIndex != NULL) && (font.glyphIndex->cache != NULL))
+    {
+        // Dynamic font glyphs loaded before layout, font atlas could change on glyphs loading
+        for (int i = 0, codepointByteCount = 0; i < size; i += codepointByteCount)
+        {
+            GetGlyphIndex(font, GetCodepointNext(&text[i], &codepointByteCount));
+        }
+
+        font.texture = GetFontTexture(font);
+    }
+
+    if (capacity > 0)
+    {
+        layout.vertices = (float *)RL_MALLOC(capacity*4*2*sizeof(float));
+        layout.texcoords = (float *)RL_MALLOC(capacity*4*2*sizeof(float));
+    }
+
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+
+    for (int i = 0; (i < size) && (layout.glyphCount < capacity);)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                GetGlyphQuad(font, index, (Vector2){ textOffsetX, textOffsetY }, scaleFactor, &layout.vertices[layout.glyphCount*8], &layout.texcoords[layout.glyphCount*8]);
+                layout.glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    layout.texture = font.texture;
+    layout.size = MeasureTextEx(font, text, fontSize, spacing);
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.vertices);
+    RL_FREE(layout.texcoords);
+}
+
+// Draw text layout, all glyphs quads drawn at once
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    rlPushMatrix();
+
+        rlTranslatef(position.x, position.y, 0.0f);
+
+        DrawTextGlyphs(layout.texture, layout.vertices, layout.texcoords, layout.glyphCount, tint);
+
+    rlPopMatrix();
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1459,26 +1765,38 @@ int GetGlyphIndex(Font font, int codepoint)
     int index = 0;
     if (!IsFontValid(font)) return index;
 
-#define SUPPORT_UNORDERED_CHARSET
-#if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
-
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
+    if (font.glyphIndex != NULL)
     {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
+        // Look for character index in the lookup generated on font loading
+        index = FindGlyphIndex(font.glyphIndex, codepoint);
 
-        if (font.glyphs[i].value == codepoint)
+        if (font.glyphIndex->cache != NULL)
         {
-            index = i;
-            break;
+            // Dynamic font, glyph loaded on first use, glyph use registered for eviction
+            if (index == -1) index = LoadFontCacheGlyph(font, codepoint);
+            else font.glyphIndex->cache->glyphsUse[index] = font.glyphIndex->cache->useCounter;
         }
+
+        if (index == -1) index = font.glyphIndex->fallback;
     }
+    else
+    {
+        // Look for character index in the unordered charset (i.e. font data defined by user)
+        int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
-#else
-    index = codepoint - 32;
-#endif
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].value == 63) fallbackIndex = i;
+
+            if (font.glyphs[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+    }
 
     return index;
 }
@@ -2581,6 +2899,454 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
+// Load glyphs lookup by codepoint, first glyph for a codepoint is used (same as linear search)
+static rGlyphIndex *LoadGlyphIndex(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphIndex *index = (rGlyphIndex *)RL_CALLOC(1, sizeof(rGlyphIndex));
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        // NOTE: Fallback glyph is the last '?' glyph, same as linear search
+        if (glyphs[i].value == 63) index->fallback = i;
+
+        AddGlyphIndex(index, glyphs[i].value, i);
+    }
+
+    return index;
+}
+
+// Unload glyphs lookup
+static void UnloadGlyphIndex(rGlyphIndex *index)
+{
+    if (index == NULL) return;
+
+    for (int p = 0; p < GLYPH_INDEX_PAGE_COUNT; p++) RL_FREE(index->pages[p]);
+    RL_FREE(index->entries);
+    RL_FREE(index);
+}
+
+// Add glyph to lookup, first glyph added for a codepoint is kept
+static void AddGlyphIndex(rGlyphIndex *index, int codepoint, int glyph)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_INDEX_PAGE_SIZE*GLYPH_INDEX_PAGE_COUNT))
+    {
+        int **page = &index->pages[codepoint/GLYPH_INDEX_PAGE_SIZE];
+
+        if (*page == NULL) *page = (int *)RL_CALLOC(GLYPH_INDEX_PAGE_SIZE, sizeof(int));
+        if ((*page)[codepoint%GLYPH_INDEX_PAGE_SIZE] == 0) (*page)[codepoint%GLYPH_INDEX_PAGE_SIZE] = glyph + 1;
+    }
+    else
+    {
+        // Find insertion position (binary search), glyphs are usually sorted by codepoint (appended)
+        int low = 0;
+        int high = index->entryCount;
+
+        while (low < high)
+        {
+            int mid = (low + high)/2;
+            if (index->entries[mid].codepoint < codepoint) low = mid + 1;
+            else high = mid;
+        }
+
+        if ((low < index->entryCount) && (index->entries[low].codepoint == codepoint)) return;
+
+        if (index->entryCount == index->entryCapacity)
+        {
+            index->entryCapacity = (index->entryCapacity > 0)? index->entryCapacity*2 : 64;
+            index->entries = (GlyphIndexEntry *)RL_REALLOC(index->entries, index->entryCapacity*sizeof(GlyphIndexEntry));
+        }
+
+        memmove(&index->entries[low + 1], &index->entries[low], (index->entryCount - low)*sizeof(GlyphIndexEntry));
+        index->entries[low] = (GlyphIndexEntry){ codepoint, glyph };
+        index->entryCount++;
+    }
+}
+
+// Find glyph in lookup, returns -1 if not available
+static int FindGlyphIndex(const rGlyphIndex *index, int codepoint)
+{
+    int glyph = -1;
+
+    if ((codepoint >= 0) && (codepoint < GLYPH_INDEX_PAGE_SIZE*GLYPH_INDEX_PAGE_COUNT))
+    {
+        const int *page = index->pages[codepoint/GLYPH_INDEX_PAGE_SIZE];
+        if (page != NULL) glyph = page[codepoint%GLYPH_INDEX_PAGE_SIZE] - 1;
+    }
+    else
+    {
+        int low = 0;
+        int high = index->entryCount - 1;
+
+        while (low <= high)
+        {
+            int mid = (low + high)/2;
+
+            if (index->entries[mid].codepoint == codepoint)
+            {
+                glyph = index->entries[mid].glyph;
+                break;
+            }
+            else if (index->entries[mid].codepoint < codepoint) low = mid + 1;
+            else high = mid - 1;
+        }
+    }
+
+    return glyph;
+}
+
+#if SUPPORT_FILEFORMAT_TTF
+// Remove glyph from lookup
+static void RemoveGlyphIndex(rGlyphIndex *index, int codepoint)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_INDEX_PAGE_SIZE*GLYPH_INDEX_PAGE_COUNT))
+    {
+        int *page = index->pages[codepoint/GLYPH_INDEX_PAGE_SIZE];
+        if (page != NULL) page[codepoint%GLYPH_INDEX_PAGE_SIZE] = 0;
+    }
+    else
+    {
+        for (int i = 0; i < index->entryCount; i++)
+        {
+            if (index->entries[i].codepoint == codepoint)
+            {
+                memmove(&index->entries[i], &index->entries[i + 1], (index->entryCount - i - 1)*sizeof(GlyphIndexEntry));
+                index->entryCount--;
+                break;
+            }
+        }
+    }
+}
+
+// Load dynamic font for a font face and size
+// NOTE: Fallback glyph '?' is loaded first (index 0) and never evicted
+static Font LoadFontCache(FontFace *face, int fontSize)
+{
+    Font font = { 0 };
+
+    if (fontSize <= 0) fontSize = FONT_TTF_DEFAULT_SIZE;
+
+    FontCache *cache = (FontCache *)RL_CALLOC(1, sizeof(FontCache));
+    cache->face = face;
+    cache->face->refCount++;
+
+    int ascent = 0;
+    stbtt_GetFontVMetrics(&face->info, &ascent, NULL, NULL);
+    cache->scale = stbtt_ScaleForPixelHeight(&face->info, (float)fontSize);
+    cache->ascent = (int)((float)ascent*cache->scale);
+
+    // Font atlas, white color and glyphs in alpha (same as GenImageFontAtlas())
+    cache->atlas.width = FONT_CACHE_ATLAS_SIZE;
+    cache->atlas.height = FONT_CACHE_ATLAS_SIZE;
+    cache->atlas.mipmaps = 1;
+    cache->atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    cache->atlas.data = RL_CALLOC(cache->atlas.width*cache->atlas.height*2, 1);
+    cache->texture = LoadTextureFromImage(cache->atlas);
+
+    cache->areas = (Rectangle *)RL_CALLOC(FONT_CACHE_GLYPHS_MAX, sizeof(Rectangle));
+    cache->glyphsUse = (unsigned int *)RL_CALLOC(FONT_CACHE_GLYPHS_MAX, sizeof(unsigned int));
+
+    font.baseSize = fontSize;
+    font.glyphCount = FONT_CACHE_GLYPHS_MAX;
+    font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+    font.texture = cache->texture;
+    font.recs = (Rectangle *)RL_CALLOC(font.glyphCount, sizeof(Rectangle));
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+    font.glyphIndex = (rGlyphIndex *)RL_CALLOC(1, sizeof(rGlyphIndex));
+    font.glyphIndex->cache = cache;
+
+    LoadFontCacheGlyph(font, '?');
+
+    return font;
+}
+
+// Load font atlas space (shelf packing), atlas grown if required
+// NOTE: Glyphs are placed on the lowest shelf fitting them, new shelves added below the last one
+static bool LoadFontCacheArea(FontCache *cache, int width, int height, Rectangle *area)
+{
+    int shelf = -1;
+
+    do
+    {
+        for (int i = 0; i < cache->shelfCount; i++)
+        {
+            if ((height <= cache->shelves[i].height) && ((cache->shelves[i].width + width) <= cache->atlas.width) &&
+                ((shelf == -1) || (cache->shelves[i].height < cache->shelves[shelf].height))) shelf = i;
+        }
+
+        if (shelf == -1)
+        {
+            int y = (cache->shelfCount > 0)? (cache->shelves[cache->shelfCount - 1].y + cache->shelves[cache->shelfCount - 1].height) : 0;
+
+            // Shelf height rounded up, glyphs with similar heights share shelves
+            int shelfHeight = ((height + 7)/8)*8;
+            if ((y + shelfHeight) > cache->atlas.height) shelfHeight = height;
+
+            if (((y + shelfHeight) <= cache->atlas.height) && (width <= cache->atlas.width))
+            {
+                if (cache->shelfCount == cache->shelfCapacity)
+                {
+                    cache->shelfCapacity = (cache->shelfCapacity > 0)? cache->shelfCapacity*2 : 16;
+                    cache->shelves = (FontCacheShelf *)RL_REALLOC(cache->shelves, cache->shelfCapacity*sizeof(FontCacheShelf));
+                }
+
+                cache->shelves[cache->shelfCount] = (FontCacheShelf){ y, shelfHeight, 0 };
+                shelf = cache->shelfCount;
+                cache->shelfCount++;
+            }
+        }
+    } while ((shelf == -1) && GrowFontCacheAtlas(cache));
+
+    if (shelf == -1) return false;
+
+    *area = (Rectangle){ (float)cache->shelves[shelf].width, (float)cache->shelves[shelf].y, (float)width, (float)height };
+    cache->shelves[shelf].width += width;
+
+    return true;
+}
+
+// Grow font atlas (double width or height), glyphs keep atlas position
+static bool GrowFontCacheAtlas(FontCache *cache)
+{
+    int width = cache->atlas.width;
+    int height = cache->atlas.height;
+
+    if ((width <= height) && (width < FONT_CACHE_ATLAS_MAX_SIZE)) width *= 2;
+    else if (height < FONT_CACHE_ATLAS_MAX_SIZE) height *= 2;
+    else return false;
+
+    // Render batch pending glyphs quads use current atlas texture
+    rlDrawRenderBatchActive();
+
+    unsigned char *data = (unsigned char *)RL_CALLOC(width*height*2, 1);
+
+    for (int y = 0; y < cache->atlas.height; y++)
+    {
+        memcpy(data + y*width*2, (unsigned char *)cache->atlas.data + y*cache->atlas.width*2, cache->atlas.width*2);
+    }
+
+    RL_FREE(cache->atlas.data);
+    cache->atlas.data = data;
+    cache->atlas.width = width;
+    cache->atlas.height = height;
+
+    // NOTE: Texture id is kept, so font.texture copies stay valid and previous filter and wrap settings are kept
+    rlResizeTexture(cache->texture.id, width, height, cache->atlas.format, cache->atlas.data);
+    cache->texture.width = width;
+    cache->texture.height = height;
+
+    TRACELOG(LOG_DEBUG, "FONT: Dynamic font atlas grown to %ix%i", width, height);
+
+    return true;
+}
+#endif
+
+// Unload dynamic font glyphs cache, font face released when not used
+static void UnloadFontCache(FontCache *cache)
+{
+    if (cache == NULL) return;
+
+    UnloadTexture(cache->texture);
+    UnloadImage(cache->atlas);
+    RL_FREE(cache->shelves);
+    RL_FREE(cache->areas);
+    RL_FREE(cache->glyphsUse);
+
+#if SUPPORT_FILEFORMAT_TTF
+    cache->face->refCount--;
+
+    if (cache->face->refCount == 0)
+    {
+        RL_FREE(cache->face->fileData);
+        RL_FREE(cache->face);
+    }
+#endif
+
+    RL_FREE(cache);
+}
+
+// Load dynamic font glyph (rasterized), returns -1 if no space available
+// NOTE: Codepoints not available in font are mapped to fallback glyph
+static int LoadFontCacheGlyph(Font font, int codepoint)
+{
+    int index = -1;
+
+#if SUPPORT_FILEFORMAT_TTF
+    FontCache *cache = font.glyphIndex->cache;
+    int padding = font.glyphPadding;
+
+    if ((stbtt_FindGlyphIndex(&cache->face->info, codepoint) == 0) && (cache->slotCount > 0))
+    {
+        AddGlyphIndex(font.glyphIndex, codepoint, font.glyphIndex->fallback);
+        return font.glyphIndex->fallback;
+    }
+
+    int width = 0;
+    int height = 0;
+    int offsetX = 0;
+    int offsetY = 0;
+    int advanceX = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&cache->face->info, cache->scale, cache->scale, codepoint, &width, &height, &offsetX, &offsetY);
+    stbtt_GetCodepointHMetrics(&cache->face->info, codepoint, &advanceX, NULL);
+
+    if (bitmap == NULL) width = height = 0;
+
+    // Glyph atlas space required, padding included
+    int areaWidth = (width > 0)? (width + 2*padding) : 0;
+    int areaHeight = (height > 0)? (height + 2*padding) : 0;
+    Rectangle area = { 0 };
+
+    // Glyph slot selection:
+    //  - Free slot and free atlas space
+    //  - Least recently used glyph with enough atlas space, glyph evicted and atlas space reused
+    //  - Least recently used glyph (all slots in use) and free atlas space, glyph evicted
+    if ((cache->slotCount < font.glyphCount) && ((areaWidth == 0) || LoadFontCacheArea(cache, areaWidth, areaHeight, &area)))
+    {
+        index = cache->slotCount;
+        cache->slotCount++;
+    }
+    else
+    {
+        for (int i = 1; i < cache->slotCount; i++)
+        {
+            if ((cache->areas[i].width >= areaWidth) && (cache->areas[i].height >= areaHeight) &&
+                ((index == -1) || (cache->glyphsUse[i] < cache->glyphsUse[index]))) index = i;
+        }
+
+        if (index != -1) area = cache->areas[index];
+        else if ((cache->slotCount == font.glyphCount) && LoadFontCacheArea(cache, areaWidth, areaHeight, &area))
+        {
+            index = 1;
+            for (int i = 2; i < cache->slotCount; i++) if (cache->glyphsUse[i] < cache->glyphsUse[index]) index = i;
+        }
+
+        if (index != -1)
+        {
+            // Glyph could be used by render batch pending quads
+            rlDrawRenderBatchActive();
+
+            RemoveGlyphIndex(font.glyphIndex, font.glyphs[index].value);
+            UnloadImage(font.glyphs[index].image);
+        }
+    }
+
+    if (index == -1)
+    {
+        TRACELOG(LOG_DEBUG, "FONT: [0x%04x] Dynamic font glyph could not be loaded, no space available", codepoint);
+        stbtt_FreeBitmap(bitmap, NULL);
+        return index;
+    }
+
+    cache->areas[index] = area;
+    font.recs[index] = (Rectangle){ 0 };
+    font.glyphs[index] = (GlyphInfo){ 0 };
+
+    if (areaWidth > 0)
+    {
+        // Copy glyph into atlas space, previous glyph pixels cleared (gray-alpha, glyph in alpha)
+        unsigned char *pixels = (unsigned char *)cache->atlas.data;
+
+        for (int y = 0; y < areaHeight; y++)
+        {
+            for (int x = 0; x < areaWidth; x++)
+            {
+                int k = (((int)area.y + y)*cache->atlas.width + (int)area.x + x)*2;
+                int px = x - padding;
+                int py = y - padding;
+
+                pixels[k] = 255;
+                pixels[k + 1] = ((px >= 0) && (px < width) && (py >= 0) && (py < height))? bitmap[py*width + px] : 0;
+            }
+        }
+
+        Image imArea = ImageFromImage(cache->atlas, area);
+        UpdateTextureRec(cache->texture, area, imArea.data);
+        UnloadImage(imArea);
+
+        font.recs[index] = (Rectangle){ area.x + padding, area.y + padding, (float)width, (float)height };
+        font.glyphs[index].image = ImageFromImage(cache->atlas, font.recs[index]);
+    }
+
+    font.glyphs[index].value = codepoint;
+    font.glyphs[index].offsetX = offsetX;
+    font.glyphs[index].offsetY = (areaWidth > 0)? (offsetY + cache->ascent) : offsetY;
+    font.glyphs[index].advanceX = (int)((float)advanceX*cache->scale);
+
+    cache->useCounter++;
+    cache->glyphsUse[index] = cache->useCounter;
+    AddGlyphIndex(font.glyphIndex, codepoint, index);
+
+    stbtt_FreeBitmap(bitmap, NULL);
+#endif
+
+    return index;
+}
+
+// Check if dynamic font glyph for codepoint is not loaded yet
+static bool IsFontCacheMiss(Font font, int codepoint)
+{
+    return ((font.glyphIndex != NULL) && (font.glyphIndex->cache != NULL) && (FindGlyphIndex(font.glyphIndex, codepoint) == -1));
+}
+
+// Get font atlas texture, dynamic font atlas texture size could change
+static Texture2D GetFontTexture(Font font)
+{
+    if ((font.glyphIndex != NULL) && (font.glyphIndex->cache != NULL)) return font.glyphIndex->cache->texture;
+
+    return font.texture;
+}
+
+// Get glyph quad vertices and texcoords (4 vertices), glyph padding considered
+// NOTE: Same quad as DrawTexturePro(): top-left, bottom-left, bottom-right, top-right
+static void GetGlyphQuad(Font font, int index, Vector2 position, float scaleFactor, float *vertices, float *texcoords)
+{
+    // Character destination rectangle on screen
+    // NOTE: Considering glyph padding on drawing
+    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    // Character source rectangle from font texture atlas
+    // NOTE: Considering glyphs padding when drawing, it could be required for outline/glow shader effects
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+
+    vertices[0] = dstRec.x;
+    vertices[1] = dstRec.y;
+    vertices[2] = dstRec.x;
+    vertices[3] = dstRec.y + dstRec.height;
+    vertices[4] = dstRec.x + dstRec.width;
+    vertices[5] = dstRec.y + dstRec.height;
+    vertices[6] = dstRec.x + dstRec.width;
+    vertices[7] = dstRec.y;
+
+    texcoords[0] = srcRec.x/width;
+    texcoords[1] = srcRec.y/height;
+    texcoords[2] = srcRec.x/width;
+    texcoords[3] = (srcRec.y + srcRec.height)/height;
+    texcoords[4] = (srcRec.x + srcRec.width)/width;
+    texcoords[5] = (srcRec.y + srcRec.height)/height;
+    texcoords[6] = (srcRec.x + srcRec.width)/width;
+    texcoords[7] = srcRec.y/height;
+}
+
+// Draw glyphs quads at once, added to render batch without per-glyph state changes
+static void DrawTextGlyphs(Texture2D texture, const float *vertices, const float *texcoords, int glyphCount, Color tint)
+{
+    if ((texture.id == 0) || (glyphCount <= 0)) return;
+
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+    rlDrawTexturedQuads(texture.id, vertices, texcoords, glyphCount);
+}
+
+
 #if SUPPORT_FILEFORMAT_FNT || SUPPORT_FILEFORMAT_BDF
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2760,6 +3526,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    font.glyphIndex = LoadGlyphIndex(font.glyphs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -3026,4 +3794,101 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, c
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+#if SUPPORT_FILEFORMAT_TTF
+// Rasterize font glyphs (FontGlyphsTask)
+// NOTE: Called from worker threads, only task glyphs are written
+static void LoadFontGlyphs(void *data)
+{
+    FontGlyphsTask *task = (FontGlyphsTask *)data;
+    GlyphInfo *glyphs = task->glyphs;
+    float scaleFactor = task->scaleFactor;
+    int fontSize = task->fontSize;
+
+    for (int k = task->first; k < task->glyphCount; k += task->step)
+    {
+        int cpWidth = 0, cpHeight = 0;   // Codepoint width and height (on generation)
+        int cp = glyphs[k].value;        // Codepoint value to get info for
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into a provided bitmap
+
+        switch (task->type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP:
+            {
+                glyphs[k].image.data = stbtt_GetCodepointBitmap(&task->fontInfo, scaleFactor, scaleFactor, cp,
+                    &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
+            } break;
+            case FONT_SDF:
+            {
+                if (cp != 32)
+                {
+                    glyphs[k].image.data = stbtt_GetCodepointSDF(&task->fontInfo, scaleFactor, cp,
+                        FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
+                        &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
+                }
+            } break;
+            //case FONT_MSDF:
+            default: break;
+        }
+
+        if (glyphs[k].image.data != NULL) // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(&task->fontInfo, cp, &glyphs[k].advanceX, NULL);
+            glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
+
+            // WARNING: If requested SDF font, sdf-glyph height is definitely bigger than fontSize due to FONT_SDF_CHAR_PADDING
+            if ((task->type != FONT_SDF) && (cpHeight > fontSize)) TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph height is bigger than requested font size: %i > %i", cp, cpHeight, (int)fontSize);
+
+            // Load glyph image
+            glyphs[k].image.width = cpWidth;
+            glyphs[k].image.height = cpHeight;
+            glyphs[k].image.mipmaps = 1;
+            glyphs[k].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+            glyphs[k].offsetY += (int)((float)task->ascent*scaleFactor);
+        }
+        //else TRACELOG(LOG_WARNING, "FONT: Glyph [0x%08x] has no image data available", cp); // Only reported for 0x20 and 0x3000
+
+        // Create an empty image for Space character (0x20), useful for sprite font generation
+        // NOTE: Another space to consider: 0x3000 (CJK - Ideographic Space)
+        if ((cp == 0x20) || (cp == 0x3000))
+        {
+            stbtt_GetCodepointHMetrics(&task->fontInfo, cp, &glyphs[k].advanceX, NULL);
+            glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
+
+            Image imSpace = {
+                .data = NULL,
+                .width = glyphs[k].advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
+
+            // Only allocate space image if required
+            if (glyphs[k].advanceX > 0) imSpace.data = RL_CALLOC(glyphs[k].advanceX*fontSize, 1);
+            else glyphs[k].advanceX = 0;
+
+            glyphs[k].image = imSpace;
+        }
+
+        if (task->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < cpWidth*cpHeight; p++)
+            {
+                if (((unsigned char *)glyphs[k].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD)
+                    ((unsigned char *)glyphs[k].image.data)[p] = 0;
+                else ((unsigned char *)glyphs[k].image.data)[p] = 255;
+            }
+        }
+    }
+}
+
+#endif      // SUPPORT_FILEFORMAT_TTF
+
 #endif      // SUPPORT_MODULE_RTEXT
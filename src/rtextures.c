@@ -72,6 +72,11 @@
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 #include <limits.h>             // Required for: INT_MAX
 
+#if (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)) && !defined(__TINYC__)
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in ImageMipmaps()]
+    #define RTEXTURES_SSE2_ENABLED
+#endif
+
 // Support only desired texture formats on stb_image
 #if !SUPPORT_FILEFORMAT_BMP
     #define STBI_NO_BMP
@@ -247,7 +252,16 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image streamed resize state, passed to stb_image_resize2 row callbacks
+typedef struct ImageResizeStreamState {
+    ImageRowLoadCallback loadRow;   // User callback to load source rows
+    ImageRowSaveCallback saveRow;   // User callback to save resized rows
+    void *userData;                 // User data passed to callbacks
+    unsigned char *row;             // Last loaded source row
+    int rowIndex;                   // Last loaded source row index (-1 if none)
+    int bytesPerPixel;              // Source and destination bytes per pixel
+    bool failed;                    // Some callback failed, rows are not processed anymore
+} ImageResizeStreamState;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -265,6 +279,14 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static unsigned char *LoadImageDataDecompressed(Image image);   // Load pixel data from compressed image as RGBA 32bit (first mipmap level)
+static bool GenImageMipmapLevel(const void *src, int srcWidth, int srcHeight, void *dst, int dstWidth, int dstHeight, int format); // Generate next mipmap level with a 2x2 box filter
+static const void *ImageResizeStreamLoadRow(void *optionalOutput, const void *inputPtr, int numPixels, int x, int y, void *context); // stb_image_resize2 input row callback
+static void ImageResizeStreamSaveRow(const void *outputPtr, int numPixels, int y, void *context); // stb_image_resize2 output row callback
+static void ImageDrawSpan(Image *dst, int x, int y, int length, const unsigned char *pixel, int bytesPerPixel); // Draw horizontal span of encoded pixels, clipped once
+static void ImageBlendPixel(Image *dst, int x, int y, Color color, float coverage); // Blend pixel within an image, color alpha scaled by coverage
+static bool GetTriangleRowSpan(const int *w, const int *wStep, int count, int *start, int *end); // Get row pixels range inside triangle edges
+static void ImageDrawImageTransformed(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint, int filter, bool blendRequired); // Draw image with scaling and rotation, sampling source directly
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1322,6 +1344,30 @@ void ImageFormat(Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
+        // Compressed data is decoded on CPU into RGBA 32bit before converting to requested format
+        if ((image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            unsigned char *decompressed = LoadImageDataDecompressed(*image);
+
+            if (decompressed != NULL)
+            {
+                RL_FREE(image->data);      // WARNING! Loosing mipmaps data --> Regenerated at the end
+                image->data = decompressed;
+                image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+                if (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+                {
+                    if (image->mipmaps > 1)
+                    {
+                        image->mipmaps = 1;
+                        ImageMipmaps(image);
+                    }
+
+                    return;
+                }
+            }
+        }
+
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
@@ -1843,6 +1889,21 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         image->width = newWidth;
         image->height = newHeight;
     }
+    else if ((image->format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+             (image->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+             (image->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        // Float formats are resized directly, avoiding precision loss of 8bit conversion
+        int channels = GetPixelDataSize(1, 1, image->format)/sizeof(float);
+        float *output = (float *)RL_MALLOC(newWidth*newHeight*channels*sizeof(float));
+
+        stbir_resize_float_linear((float *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels);
+
+        RL_FREE(image->data);
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+    }
     else
     {
         // Get data as Color pixels array to work with it
@@ -1866,6 +1927,53 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     }
 }
 
+// Resize image data streamed by rows (Bicubic scaling algorithm)
+// NOTE 1: Only source rows required by filter are kept in memory, useful for images too big to be fully loaded,
+// source rows are requested in increasing order and resized rows are provided in order as soon as available
+// NOTE 2: Supported formats: 8bit per channel (GRAYSCALE, GRAY_ALPHA, R8G8B8, R8G8B8A8) and 32bit float per channel
+bool ImageResizeStream(int width, int height, int format, int newWidth, int newHeight, ImageRowLoadCallback loadRow, ImageRowSaveCallback saveRow, void *userData)
+{
+    if ((width <= 0) || (height <= 0) || (newWidth <= 0) || (newHeight <= 0) || (loadRow == NULL) || (saveRow == NULL)) return false;
+
+    stbir_datatype dataType = STBIR_TYPE_UINT8;
+    int channels = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: channels = 1; dataType = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: channels = 3; dataType = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: channels = 4; dataType = STBIR_TYPE_FLOAT; break;
+        default: TRACELOG(LOG_WARNING, "IMAGE: Pixel format not supported for streamed resize"); return false;
+    }
+
+    ImageResizeStreamState state = { 0 };
+    state.loadRow = loadRow;
+    state.saveRow = saveRow;
+    state.userData = userData;
+    state.bytesPerPixel = GetPixelDataSize(1, 1, format);
+    state.rowIndex = -1;
+    state.row = (unsigned char *)RL_MALLOC(width*state.bytesPerPixel);
+
+    if (state.row == NULL) return false;
+
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, NULL, width, height, 0, NULL, newWidth, newHeight, 0, (stbir_pixel_layout)channels, dataType);
+    stbir_set_pixel_callbacks(&resize, ImageResizeStreamLoadRow, ImageResizeStreamSaveRow);
+    stbir_set_user_data(&resize, &state);
+
+    bool result = (stbir_resize_extended(&resize) != 0) && !state.failed;
+
+    RL_FREE(state.row);
+
+    if (!result) TRACELOG(LOG_WARNING, "IMAGE: Failed to resize streamed image data");
+
+    return result;
+}
+
 // Resize canvas and fill with color
 // NOTE: Resize offset is relative to the top-left corner of the original image
 void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill)
@@ -2430,6 +2538,7 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 // NOTE 1: Supports POT and NPOT images
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
+// NOTE 4: Every level is generated from previous one using a 2x2 box filter (8bit and float formats)
 void ImageMipmaps(Image *image)
 {
     // Security check to avoid program crash
@@ -2458,24 +2567,29 @@ void ImageMipmaps(Image *image)
 
     if (image->mipmaps < mipCount)
     {
-        // Create second buffer and copy data manually to it
-        void *temp = RL_CALLOC(mipSize, 1);
-        memcpy(temp, image->data, GetPixelDataSize(image->width, image->height, image->format));
-        RL_FREE(image->data);
+        // Grow data buffer to fit all mipmap levels, already available levels are kept
+        void *temp = RL_REALLOC(image->data, mipSize);
+        if (temp == NULL) { TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate memory for mipmaps"); return; }
         image->data = temp;
 
         // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *prevmip = (unsigned char *)image->data;
         unsigned char *nextmip = (unsigned char *)image->data;
 
+        int prevWidth = image->width;
+        int prevHeight = image->height;
         mipWidth = image->width;
         mipHeight = image->height;
         mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+        Image imCopy = { 0 };
 
         for (int i = 1; i < mipCount; i++)
         {
+            prevmip = nextmip;
             nextmip += mipSize;
 
+            prevWidth = mipWidth;
+            prevHeight = mipHeight;
             mipWidth /= 2;
             mipHeight /= 2;
 
@@ -2488,8 +2602,16 @@ void ImageMipmaps(Image *image)
             if (i < image->mipmaps) continue;
 
             TRACELOG(LOG_DEBUG, "IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
-            memcpy(nextmip, imCopy.data, mipSize);
+
+            // Every level is derived from previous one with a 2x2 box filter,
+            // formats not supported by the box filter are resized from base level
+            if (!GenImageMipmapLevel(prevmip, prevWidth, prevHeight, nextmip, mipWidth, mipHeight, image->format))
+            {
+                if (imCopy.data == NULL) imCopy = ImageFromImage(*image, (Rectangle){ 0, 0, (float)image->width, (float)image->height });
+
+                ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+                memcpy(nextmip, imCopy.data, mipSize);
+            }
         }
 
         UnloadImage(imCopy);
@@ -3014,9 +3136,16 @@ Color *LoadImageColors(Image image)
 {
     if ((image.width == 0) || (image.height == 0)) return NULL; // Security check
 
+    // Compressed formats are decoded on CPU, RGBA 32bit output matches Color layout
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        Color *decompressed = (Color *)LoadImageDataDecompressed(image);
+        if (decompressed != NULL) return decompressed;
+    }
+
     Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image format");
     else
     {
         if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
@@ -3426,138 +3555,9 @@ void ImageDrawPixel(Image *dst, int x, int y, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
-    switch (dst->format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
-
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
 
-        } break;
-        default: break;
-    }
+    SetPixelColor((unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel, color, dst->format);
 }
 
 // Draw pixel within an image (Vector version)
@@ -3569,6 +3569,10 @@ void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
 // Draw line within an image
 void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
     // Calculate differences in coordinates
     int shortLen = endPosY - startPosY;
     int longLen = endPosX - startPosX;
@@ -3599,6 +3603,11 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
     // Calculate fixed-point increment for shorter length
     int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
 
+    // Pixel color is encoded once for the full line
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    SetPixelColor(pixel, color, dst->format);
+
     // Draw the line pixel by pixel
     if (yLonger)
     {
@@ -3607,16 +3616,21 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
         for (int i = 0, j = (1 << 15); i != endVal; i += sgnInc, j += decInc)
         {
             // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
+            ImageDrawSpan(dst, startPosX + (j >> 16), startPosY + i, 1, pixel, bytesPerPixel);
         }
     }
+    else if (shortLen == 0)
+    {
+        // Horizontal line is drawn as a single span
+        ImageDrawSpan(dst, (sgnInc > 0)? startPosX : startPosX - longLen, startPosY, longLen + 1, pixel, bytesPerPixel);
+    }
     else
     {
         // If line is more horizontal, iterate over x-axis
         for (int i = 0, j = (1 << 15); i != endVal; i += sgnInc, j += decInc)
         {
             // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
+            ImageDrawSpan(dst, startPosX + i, startPosY + (j >> 16), 1, pixel, bytesPerPixel);
         }
     }
 }
@@ -3697,9 +3711,68 @@ void ImageDrawLineStrip(Image *dst, const Vector2 *points, int pointCount, Color
     }
 }
 
+// Draw anti-aliased line within an image, using Xiaolin Wu algorithm
+void ImageDrawLineAA(Image *dst, Vector2 start, Vector2 end, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
+    // Line is rasterized along the major axis, swapping coordinates for steep lines
+    bool steep = (fabsf(end.y - start.y) > fabsf(end.x - start.x));
+    float x0 = start.x, y0 = start.y, x1 = end.x, y1 = end.y;
+    float temp = 0.0f;
+
+    if (steep)
+    {
+        temp = x0; x0 = y0; y0 = temp;
+        temp = x1; x1 = y1; y1 = temp;
+    }
+
+    if (x0 > x1)
+    {
+        temp = x0; x0 = x1; x1 = temp;
+        temp = y0; y0 = y1; y1 = temp;
+    }
+
+    float dx = x1 - x0;
+    float gradient = (dx == 0.0f)? 1.0f : (y1 - y0)/dx;
+
+    // Line endpoints are drawn with coverage scaled by the horizontal overlap of the pixel
+    int xStart = (int)roundf(x0);
+    int xEnd = (int)roundf(x1);
+    float intersectY = y0 + gradient*(xStart - x0);
+
+    for (int x = xStart; x <= xEnd; x++, intersectY += gradient)
+    {
+        float overlap = 1.0f;
+        if (x == xStart) overlap = 1.0f - ((x0 + 0.5f) - floorf(x0 + 0.5f));
+        if (x == xEnd) overlap = (xStart == xEnd)? (x1 - x0) : ((x1 + 0.5f) - floorf(x1 + 0.5f));
+        if (overlap <= 0.0f) continue;
+
+        int y = (int)floorf(intersectY);
+        float frac = intersectY - y;
+
+        if (steep)
+        {
+            ImageBlendPixel(dst, y, x, color, (1.0f - frac)*overlap);
+            ImageBlendPixel(dst, y + 1, x, color, frac*overlap);
+        }
+        else
+        {
+            ImageBlendPixel(dst, x, y, color, (1.0f - frac)*overlap);
+            ImageBlendPixel(dst, x, y + 1, color, frac*overlap);
+        }
+    }
+}
+
 // Draw triangle within an image
 void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
     // Calculate the 2D bounding box of the triangle
     // Determine the minimum and maximum x and y coordinates of the triangle vertices
     int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
@@ -3737,25 +3810,22 @@ void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color col
     int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
     int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
 
+    // Pixel color is encoded once for the full triangle
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    SetPixelColor(pixel, color, dst->format);
+
+    const int wXStep[3] = { w1XStep, w2XStep, w3XStep };
+
     // Rasterization loop
-    // Iterate through each pixel in the bounding box
+    // Every row inside the triangle is a single span, computed from barycentric coordinates
     for (int y = yMin; y <= yMax; y++)
     {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+        const int w[3] = { w1Row, w2Row, w3Row };
+        int start = 0;
+        int end = 0;
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            // If it is, the pixel can be drawn with the given color
-            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
-
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+        if (GetTriangleRowSpan(w, wXStep, xMax - xMin + 1, &start, &end)) ImageDrawSpan(dst, xMin + start, y, end - start + 1, pixel, bytesPerPixel);
 
         // Move to the next row in the bounding box
         w1Row += w1YStep;
@@ -3767,6 +3837,10 @@ void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color col
 // Draw triangle with interpolated colors within an image
 void ImageDrawTriangleGradient(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
     // Calculate the 2D bounding box of the triangle
     // Determine the minimum and maximum x and y coordinates of the triangle vertices
     int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
@@ -3807,18 +3881,27 @@ void ImageDrawTriangleGradient(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, C
     // Calculate the inverse of the sum of the barycentric coordinates for normalization
     float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
 
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    const int wXStep[3] = { w1XStep, w2XStep, w3XStep };
+
     // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
+    // Iterate through the pixels span inside the triangle on every row
+    for (int y = yMin; (y <= yMax) && (y < dst->height); y++)
     {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+        const int w[3] = { w1Row, w2Row, w3Row };
+        int start = 0;
+        int end = 0;
 
-        for (int x = xMin; x <= xMax; x++)
+        if (GetTriangleRowSpan(w, wXStep, xMax - xMin + 1, &start, &end) && ((xMin + start) < dst->width))
         {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            if ((w1 | w2 | w3) >= 0)
+            if ((xMin + end) >= dst->width) end = dst->width - 1 - xMin;
+
+            int w1 = w1Row + start*w1XStep;
+            int w2 = w2Row + start*w2XStep;
+            int w3 = w3Row + start*w3XStep;
+            unsigned char *dstPtr = (unsigned char *)dst->data + ((size_t)y*dst->width + xMin + start)*bytesPerPixel;
+
+            for (int x = start; x <= end; x++, dstPtr += bytesPerPixel)
             {
                 // Compute the normalized barycentric coordinates
                 unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
@@ -3833,13 +3916,13 @@ void ImageDrawTriangleGradient(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, C
                 finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
 
                 // Draw the pixel with the interpolated color
-                ImageDrawPixel(dst, x, y, finalColor);
-            }
+                SetPixelColor(dstPtr, finalColor, dst->format);
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
+                // Increment the barycentric coordinates for the next pixel
+                w1 += w1XStep;
+                w2 += w2XStep;
+                w3 += w3XStep;
+            }
         }
 
         // Move to the next row in the bounding box
@@ -3899,6 +3982,7 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
 
     // Security check to avoid drawing out of bounds in case of bad user data
     if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
@@ -3914,24 +3998,22 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
     if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
 
+    // Nothing to draw if clipped rectangle is empty
+    if (((int)rec.width <= 0) || ((int)rec.height <= 0)) return;
+
     int sy = (int)rec.y;
     int sx = (int)rec.x;
 
     int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
 
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
+    // Fill the first row with pixel color, encoded once based on image format
+    unsigned char pixel[16] = { 0 };
+    SetPixelColor(pixel, color, dst->format);
+    ImageDrawSpan(dst, sx, sy, (int)rec.width, pixel, bytesPerPixel);
 
     int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
     unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
 
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x *= 2)
-    {
-        int pixelsToCopy = MIN(x, (int)rec.width - x);
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
-    }
-
     // Repeat the first row data for all other rows
     int bytesPerRow = bytesPerPixel*(int)rec.width;
     for (int y = 1; y < (int)rec.height; y++)
@@ -3971,16 +4053,26 @@ void ImageDrawRectangleGradientEx(Image *dst, Rectangle rec, Color col1, Color c
 // Draw circle within an image
 void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
+    // Pixel color is encoded once for the full circle
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    SetPixelColor(pixel, color, dst->format);
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        // NOTE: Zero length rows still draw one pixel, as ImageDrawRectangle() used to do
+        ImageDrawSpan(dst, centerX - x, centerY + y, (x > 0)? x*2 : 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - x, centerY - y, (x > 0)? x*2 : 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - y, centerY + x, (y > 0)? y*2 : 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - y, centerY - x, (y > 0)? y*2 : 1, pixel, bytesPerPixel);
         x++;
 
         if (decesionParameter > 0)
@@ -4001,20 +4093,29 @@ void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color)
 // Draw circle outline within an image
 void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
+    // Pixel color is encoded once for the full circle
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    SetPixelColor(pixel, color, dst->format);
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        ImageDrawSpan(dst, centerX + x, centerY + y, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - x, centerY + y, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX + x, centerY - y, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - x, centerY - y, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX + y, centerY + x, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - y, centerY + x, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX + y, centerY - x, 1, pixel, bytesPerPixel);
+        ImageDrawSpan(dst, centerX - y, centerY - x, 1, pixel, bytesPerPixel);
         x++;
 
         if (decesionParameter > 0)
@@ -4032,6 +4133,64 @@ void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
     ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
 }
 
+// Draw anti-aliased circle within an image
+// NOTE: Interior pixels are overwritten as spans, only edge pixels are blended by coverage
+void ImageDrawCircleAA(Image *dst, Vector2 center, float radius, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (radius <= 0.0f)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "IMAGE: Image drawing not supported for compressed formats"); return; }
+
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    SetPixelColor(pixel, color, dst->format);
+
+    // NOTE: Pixel centers are at integer coordinates, like ImageDrawCircle()
+    int yMin = (int)floorf(center.y - radius - 0.5f);
+    int yMax = (int)ceilf(center.y + radius + 0.5f);
+    if (yMin < 0) yMin = 0;
+    if (yMax > (dst->height - 1)) yMax = dst->height - 1;
+
+    float outerRadius = radius + 0.5f;
+    float innerRadius = radius - 0.5f;
+
+    for (int y = yMin; y <= yMax; y++)
+    {
+        float dy = (float)y - center.y;
+        float dy2 = dy*dy;
+
+        if (dy2 >= outerRadius*outerRadius) continue;
+
+        // Horizontal extent of the row touched by the circle edge
+        float outerHalf = sqrtf(outerRadius*outerRadius - dy2);
+        int xMin = (int)floorf(center.x - outerHalf);
+        int xMax = (int)ceilf(center.x + outerHalf);
+
+        // Horizontal extent of the row fully covered by the circle
+        int innerStart = xMax + 1;
+        int innerEnd = xMax;
+        if ((innerRadius > 0.0f) && (dy2 < innerRadius*innerRadius))
+        {
+            float innerHalf = sqrtf(innerRadius*innerRadius - dy2);
+            innerStart = (int)ceilf(center.x - innerHalf);
+            innerEnd = (int)floorf(center.x + innerHalf);
+
+            if (innerEnd >= innerStart) ImageDrawSpan(dst, innerStart, y, innerEnd - innerStart + 1, pixel, bytesPerPixel);
+            else innerStart = xMax + 1, innerEnd = xMax;
+        }
+
+        for (int x = xMin; x <= xMax; x++)
+        {
+            if ((x >= innerStart) && (x <= innerEnd)) { x = innerEnd; continue; }
+
+            float dx = (float)x - center.x;
+            float coverage = outerRadius - sqrtf(dx*dx + dy2);
+
+            if (coverage > 0.0f) ImageBlendPixel(dst, x, y, color, (coverage > 1.0f)? 1.0f : coverage);
+        }
+    }
+}
+
 // Draw a gradient-filled circle within an image
 void ImageDrawCircleGradient(Image *dst, Vector2 center, float radius, Color inner, Color outer)
 {
@@ -4049,7 +4208,9 @@ void ImageDrawImage(Image *dst, Image src, int posX, int posY, Color tint)
 // Draw an image with scaling and rotation within an image
 void ImageDrawImageEx(Image *dst, Image src, Vector2 position, float rotation, float scale, Color tint)
 {
-    // TODO: NEW: Implement ImageDrawImageEx()
+    Rectangle srcRec = { 0.0f, 0.0f, (float)src.width, (float)src.height };
+    Rectangle dstRec = { position.x, position.y, srcRec.width*scale, srcRec.height*scale };
+    ImageDrawImagePro(dst, src, srcRec, dstRec, (Vector2){ 0 }, rotation, tint);
 }
 
 // Draw a part of an image defined by a rectangle within an image
@@ -4060,126 +4221,136 @@ void ImageDrawImageRec(Image *dst, Image src, Rectangle srcRec, Vector2 position
 }
 
 // Draw a part of an image defined by a rectangle into destination rectangle, with scaling and rotation, within an image
-// TODO: REVIEW: ImageDrawImagePro(), implement origin and rotation for image drawing
+// NOTE: Bilinear filtering is used when scaling or rotation is required
 void ImageDrawImagePro(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint)
+{
+    ImageDrawImageProFilter(dst, src, srcRec, dstRec, origin, rotation, tint, TEXTURE_FILTER_BILINEAR);
+}
+
+// Draw a part of an image defined by a rectangle into destination rectangle, with scaling, rotation and filter, within an image
+// NOTE: Supported filters: TEXTURE_FILTER_POINT, TEXTURE_FILTER_BILINEAR (used for any other filter)
+void ImageDrawImageProFilter(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint, int filter)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
         (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
-    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    if ((dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (src.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
     else
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
-
         // Source rectangle out-of-bounds security checks
         if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
         if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
         if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
         if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, make a copy of source, and apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
-        {
-            srcMod = ImageFromImage(src, srcRec); // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height); // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+        if (((int)srcRec.width <= 0) || ((int)srcRec.height <= 0)) return;
 
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+        Rectangle mipmapSrcRec = srcRec;    // Source rectangle before destination clipping, for next mipmap level
+        Rectangle mipmapDstRec = dstRec;    // Destination rectangle before destination clipping, for next mipmap level
 
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x -= dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+        // Fast path: Avoid blend if source has no alpha to blend and no tint is applied
+        bool blendRequired = true;
+        if ((tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255) &&
+            ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+            (src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+            (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+            (src.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (src.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (src.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (src.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)))
+            blendRequired = false;
 
-        if (dstRec.y < 0)
+        // Scaled or rotated drawing samples source pixels directly for every destination pixel,
+        // no intermediate resized copy of the source is required
+        if ((rotation != 0.0f) || ((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
         {
-            srcRec.y -= dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
+            ImageDrawImageTransformed(dst, src, srcRec, dstRec, origin, rotation, tint, filter, blendRequired);
         }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
-
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
-
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [-] Support 16bit and 32bit (float) channels drawing
+        else
+        {
+            // Origin is the destination rectangle point placed at destination position
+            dstRec.x -= origin.x;
+            dstRec.y -= origin.y;
 
-        Color colSrc = { 0 };
-        Color colDst = { 0 };
-        Color blend = { 0 };
-        bool blendRequired = true;
+            // Destination rectangle out-of-bounds security checks
+            if (dstRec.x < 0)
+            {
+                srcRec.x -= dstRec.x;
+                srcRec.width += dstRec.x;
+                dstRec.x = 0;
+            }
+            else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) &&
-            ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)))
-            blendRequired = false;
+            if (dstRec.y < 0)
+            {
+                srcRec.y -= dstRec.y;
+                srcRec.height += dstRec.y;
+                dstRec.y = 0;
+            }
+            else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+            if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+            if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+            // This blitting method is quite fast! The process followed is:
+            // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
+            // Some optimization ideas:
+            //    [x] Avoid creating source copy if not required (no resize required)
+            //    [x] Avoid source copy for scaling/rotation, sample source directly
+            //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
+            //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
+            //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
+            //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+            //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+            //    [-] Support 16bit and 32bit (float) channels drawing
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+            Color colSrc = { 0 };
+            Color colDst = { 0 };
+            Color blend = { 0 };
 
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+            int bytesPerPixelDst = strideDst/(dst->width);
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
+            int strideSrc = GetPixelDataSize(src.width, 1, src.format);
+            int bytesPerPixelSrc = strideSrc/(src.width);
+
+            unsigned char *pSrcBase = (unsigned char *)src.data + ((int)srcRec.y*src.width + (int)srcRec.x)*bytesPerPixelSrc;
+            unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+
+            for (int y = 0; y < (int)srcRec.height; y++)
             {
-                for (int x = 0; x < (int)srcRec.width; x++)
+                unsigned char *pSrc = pSrcBase;
+                unsigned char *pDst = pDstBase;
+
+                // Fast path: Avoid moving pixel by pixel if no blend required and same format
+                if (!blendRequired && (src.format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+                else
                 {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+                    for (int x = 0; x < (int)srcRec.width; x++)
+                    {
+                        colSrc = GetPixelColor(pSrc, src.format);
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+                        // Fast path: Avoid blend if source has no alpha to blend
+                        if (blendRequired)
+                        {
+                            colDst = GetPixelColor(pDst, dst->format);
+                            blend = ColorAlphaBlend(colDst, colSrc, tint);
+                        }
+                        else blend = colSrc;
 
-                    SetPixelColor(pDst, blend, dst->format);
+                        SetPixelColor(pDst, blend, dst->format);
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
+                        pDst += bytesPerPixelDst;
+                        pSrc += bytesPerPixelSrc;
+                    }
                 }
-            }
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
+                pSrcBase += strideSrc;
+                pDstBase += strideDst;
+            }
         }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
-
         if ((dst->mipmaps > 1) && (src.mipmaps > 1))
         {
             Image mipmapDst = *dst;
@@ -4194,19 +4365,17 @@ void ImageDrawImagePro(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec
             mipmapSrc.height /= 2;
             mipmapSrc.mipmaps--;
 
-            Rectangle mipmapSrcRec = srcRec;
             mipmapSrcRec.width /= 2;
             mipmapSrcRec.height /= 2;
             mipmapSrcRec.x /= 2;
             mipmapSrcRec.y /= 2;
 
-            Rectangle mipmapDstRec = dstRec;
             mipmapDstRec.width /= 2;
             mipmapDstRec.height /= 2;
             mipmapDstRec.x /= 2;
             mipmapDstRec.y /= 2;
 
-            ImageDrawImagePro(&mipmapDst, mipmapSrc, mipmapSrcRec, mipmapDstRec, (Vector2){ 0 }, 0.0f, tint);
+            ImageDrawImageProFilter(&mipmapDst, mipmapSrc, mipmapSrcRec, mipmapDstRec, (Vector2){ origin.x/2, origin.y/2 }, rotation, tint, filter);
         }
     }
 }
@@ -4271,6 +4440,23 @@ Texture2D LoadTextureFromImage(Image image)
 
     if ((image.width != 0) && (image.height != 0))
     {
+        // Software renderer does not support compressed textures, data is decoded on CPU
+        if ((rlGetVersion() == RL_OPENGL_SOFTWARE) && (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            Image decompressed = ImageCopy(image);
+            ImageFormat(&decompressed, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            if (decompressed.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                texture = LoadTextureFromImage(decompressed);
+                UnloadImage(decompressed);
+
+                return texture;
+            }
+
+            UnloadImage(decompressed);
+        }
+
         texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
@@ -5483,6 +5669,62 @@ void SetPixelColor(void *dstPtr, Color color, int format)
             ((unsigned char *)dstPtr)[2] = color.b;
             ((unsigned char *)dstPtr)[3] = color.a;
 
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dstPtr)[0] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dstPtr)[0] = coln.x;
+            ((float *)dstPtr)[1] = coln.y;
+            ((float *)dstPtr)[2] = coln.z;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((float *)dstPtr)[0] = coln.x;
+            ((float *)dstPtr)[1] = coln.y;
+            ((float *)dstPtr)[2] = coln.z;
+            ((float *)dstPtr)[3] = coln.w;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned short*)dstPtr)[0] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned short *)dstPtr)[0] = FloatToHalf(coln.x);
+            ((unsigned short *)dstPtr)[1] = FloatToHalf(coln.y);
+            ((unsigned short *)dstPtr)[2] = FloatToHalf(coln.z);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((unsigned short *)dstPtr)[0] = FloatToHalf(coln.x);
+            ((unsigned short *)dstPtr)[1] = FloatToHalf(coln.y);
+            ((unsigned short *)dstPtr)[2] = FloatToHalf(coln.z);
+            ((unsigned short *)dstPtr)[3] = FloatToHalf(coln.w);
+
         } break;
         default: break;
     }
@@ -5729,4 +5971,413 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Load pixel data from compressed image as RGBA 32bit (first mipmap level)
+// NOTE: Supported formats: DXT1, DXT3, DXT5, ETC1, ETC2, ETC2_EAC, ASTC (LDR)
+static unsigned char *LoadImageDataDecompressed(Image image)
+{
+    unsigned char *pixels = NULL;
+
+#if defined(RLTEXGPU_IMPLEMENTATION)
+    pixels = rl_decompress_image_data(image.data, image.width, image.height, image.format);
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: Compressed image formats not supported, data can not be decompressed");
+#endif
+
+    return pixels;
+}
+
+// Generate next mipmap level with a 2x2 box filter, averaging previous level pixels
+// NOTE: Only 8bit and 32bit float per channel uncompressed formats supported,
+// odd sizes reuse the last row/column as border
+static bool GenImageMipmapLevel(const void *src, int srcWidth, int srcHeight, void *dst, int dstWidth, int dstHeight, int format)
+{
+    int channels = 0;
+    bool isFloat = false;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: channels = 1; isFloat = true; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: channels = 3; isFloat = true; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: channels = 4; isFloat = true; break;
+        default: return false;
+    }
+
+    for (int y = 0; y < dstHeight; y++)
+    {
+        int y0 = (2*y < srcHeight)? 2*y : srcHeight - 1;
+        int y1 = (2*y + 1 < srcHeight)? 2*y + 1 : srcHeight - 1;
+        int x = 0;
+
+        if (isFloat)
+        {
+            const float *row0 = (const float *)src + y0*srcWidth*channels;
+            const float *row1 = (const float *)src + y1*srcWidth*channels;
+            float *out = (float *)dst + y*dstWidth*channels;
+
+            for (; x < dstWidth; x++)
+            {
+                int x0 = ((2*x < srcWidth)? 2*x : srcWidth - 1)*channels;
+                int x1 = ((2*x + 1 < srcWidth)? 2*x + 1 : srcWidth - 1)*channels;
+
+                for (int c = 0; c < channels; c++) out[x*channels + c] = (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c])*0.25f;
+            }
+        }
+        else
+        {
+            const unsigned char *row0 = (const unsigned char *)src + y0*srcWidth*channels;
+            const unsigned char *row1 = (const unsigned char *)src + y1*srcWidth*channels;
+            unsigned char *out = (unsigned char *)dst + y*dstWidth*channels;
+
+#if defined(RTEXTURES_SSE2_ENABLED)
+            // Process 4 RGBA pixels per iteration while source pixel pairs are complete
+            if ((channels == 4) && (srcWidth > 1))
+            {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i bias = _mm_set1_epi16(2);
+                int simdWidth = (srcWidth/2 < dstWidth)? srcWidth/2 : dstWidth;
+
+                for (; (x + 4) <= simdWidth; x += 4)
+                {
+                    __m128i a0 = _mm_loadu_si128((const __m128i *)(row0 + x*8));
+                    __m128i a1 = _mm_loadu_si128((const __m128i *)(row0 + x*8 + 16));
+                    __m128i b0 = _mm_loadu_si128((const __m128i *)(row1 + x*8));
+                    __m128i b1 = _mm_loadu_si128((const __m128i *)(row1 + x*8 + 16));
+
+                    // Widen to 16bit and add both rows, every register holds two source pixels
+                    __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+                    __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+                    __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+                    __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+                    // Add horizontal neighbours, round and divide by 4
+                    __m128i d0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+                    __m128i d1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+                    d0 = _mm_srli_epi16(_mm_add_epi16(d0, bias), 2);
+                    d1 = _mm_srli_epi16(_mm_add_epi16(d1, bias), 2);
+
+                    _mm_storeu_si128((__m128i *)(out + x*4), _mm_packus_epi16(d0, d1));
+                }
+            }
+#endif
+            for (; x < dstWidth; x++)
+            {
+                int x0 = ((2*x < srcWidth)? 2*x : srcWidth - 1)*channels;
+                int x1 = ((2*x + 1 < srcWidth)? 2*x + 1 : srcWidth - 1)*channels;
+
+                for (int c = 0; c < channels; c++) out[x*channels + c] = (unsigned char)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+            }
+        }
+    }
+
+    return true;
+}
+
+// Input row callback for ImageResizeStream(), source rows are loaded once and kept while requested
+static const void *ImageResizeStreamLoadRow(void *optionalOutput, const void *inputPtr, int numPixels, int x, int y, void *context)
+{
+    ImageResizeStreamState *state = (ImageResizeStreamState *)context;
+
+    if ((state->rowIndex != y) && !state->failed)
+    {
+        if (state->loadRow(y, state->row, state->userData)) state->rowIndex = y;
+        else state->failed = true;
+    }
+
+    return state->row + x*state->bytesPerPixel;
+}
+
+// Output row callback for ImageResizeStream()
+static void ImageResizeStreamSaveRow(const void *outputPtr, int numPixels, int y, void *context)
+{
+    ImageResizeStreamState *state = (ImageResizeStreamState *)context;
+
+    if (!state->failed && !state->saveRow(y, outputPtr, state->userData)) state->failed = true;
+}
+
+// Draw horizontal span of encoded pixels within an image
+// NOTE: Span is clipped once against image bounds, then filled without per-pixel checks,
+// only uncompressed formats supported (checked by callers)
+static void ImageDrawSpan(Image *dst, int x, int y, int length, const unsigned char *pixel, int bytesPerPixel)
+{
+    if ((y < 0) || (y >= dst->height) || (length <= 0)) return;
+    if (x < 0) { length += x; x = 0; }
+    if ((x + length) > dst->width) length = dst->width - x;
+    if (length <= 0) return;
+
+    unsigned char *dstPtr = (unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel;
+
+    switch (bytesPerPixel)
+    {
+        case 1: memset(dstPtr, pixel[0], length); break;
+        case 2:
+        {
+            unsigned short value = 0;
+            memcpy(&value, pixel, 2);
+            for (int i = 0; i < length; i++) memcpy(dstPtr + i*2, &value, 2);
+        } break;
+        case 4:
+        {
+            unsigned int value = 0;
+            memcpy(&value, pixel, 4);
+            for (int i = 0; i < length; i++) memcpy(dstPtr + i*4, &value, 4);
+        } break;
+        default:
+        {
+            // Copy first pixel and keep doubling the filled range
+            memcpy(dstPtr, pixel, bytesPerPixel);
+            for (int filled = 1; filled < length; filled *= 2)
+            {
+                int pixelsToCopy = MIN(filled, length - filled);
+                memcpy(dstPtr + filled*bytesPerPixel, dstPtr, pixelsToCopy*bytesPerPixel);
+            }
+        } break;
+    }
+}
+
+// Blend pixel within an image, color alpha scaled by coverage
+static void ImageBlendPixel(Image *dst, int x, int y, Color color, float coverage)
+{
+    if ((x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height) || (coverage <= 0.0f)) return;
+
+    if (coverage < 1.0f) color.a = (unsigned char)(color.a*coverage + 0.5f);
+
+    Color dstColor = GetImageColor(*dst, x, y);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    SetPixelColor((unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel, ColorAlphaBlend(dstColor, color, WHITE), dst->format);
+}
+
+// Get row pixels range inside triangle edges
+// NOTE: Every edge function w + i*wStep must be >= 0, range [start, end] is solved per edge,
+// returns false if no pixel of the row [0, count - 1] is inside the triangle
+static bool GetTriangleRowSpan(const int *w, const int *wStep, int count, int *start, int *end)
+{
+    int lo = 0;
+    int hi = count - 1;
+
+    for (int i = 0; (i < 3) && (lo <= hi); i++)
+    {
+        if (wStep[i] > 0)
+        {
+            // Edge function increasing, first valid pixel: ceil(-w/step)
+            if (w[i] < 0)
+            {
+                int first = (int)((-(long long)w[i] + wStep[i] - 1)/wStep[i]);
+                if (first > lo) lo = first;
+            }
+        }
+        else if (wStep[i] < 0)
+        {
+            // Edge function decreasing, last valid pixel: floor(w/-step)
+            if (w[i] < 0) return false;
+
+            int last = (int)((long long)w[i]/(-wStep[i]));
+            if (last < hi) hi = last;
+        }
+        else if (w[i] < 0) return false;
+    }
+
+    if (lo > hi) return false;
+
+    *start = lo;
+    *end = hi;
+
+    return true;
+}
+
+// Draw image with scaling and rotation, sampling source directly
+// NOTE: Every destination row is mapped back into source space with an affine transform,
+// only the row span falling inside source rectangle is processed
+static void ImageDrawImageTransformed(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint, int filter, bool blendRequired)
+{
+    if ((dstRec.width <= 0.0f) || (dstRec.height <= 0.0f)) return;
+
+    float cosRot = cosf(rotation*DEG2RAD);
+    float sinRot = sinf(rotation*DEG2RAD);
+    float scaleX = srcRec.width/dstRec.width;
+    float scaleY = srcRec.height/dstRec.height;
+
+    // Destination bounding box, from destination rectangle corners rotated around position
+    Vector2 corners[4] = {
+        { -origin.x, -origin.y },
+        { dstRec.width - origin.x, -origin.y },
+        { dstRec.width - origin.x, dstRec.height - origin.y },
+        { -origin.x, dstRec.height - origin.y }
+    };
+
+    float minX = (float)dst->width, minY = (float)dst->height;
+    float maxX = 0.0f, maxY = 0.0f;
+
+    for (int i = 0; i < 4; i++)
+    {
+        float x = dstRec.x + corners[i].x*cosRot - corners[i].y*sinRot;
+        float y = dstRec.y + corners[i].x*sinRot + corners[i].y*cosRot;
+
+        if (i == 0) { minX = maxX = x; minY = maxY = y; }
+        else
+        {
+            if (x < minX) minX = x;
+            if (x > maxX) maxX = x;
+            if (y < minY) minY = y;
+            if (y > maxY) maxY = y;
+        }
+    }
+
+    int xMin = (int)floorf(minX);
+    int yMin = (int)floorf(minY);
+    int xMax = (int)ceilf(maxX);
+    int yMax = (int)ceilf(maxY);
+
+    if (xMin < 0) xMin = 0;
+    if (yMin < 0) yMin = 0;
+    if (xMax > (dst->width - 1)) xMax = dst->width - 1;
+    if (yMax > (dst->height - 1)) yMax = dst->height - 1;
+    if ((xMin > xMax) || (yMin > yMax)) return;
+
+    // Source coordinates increments per destination pixel along the row
+    float uStepX = cosRot*scaleX;
+    float vStepX = -sinRot*scaleY;
+
+    // Source pixels valid range, samples are clamped to it
+    int srcMinX = (int)srcRec.x;
+    int srcMinY = (int)srcRec.y;
+    int srcMaxX = srcMinX + (int)srcRec.width - 1;
+    int srcMaxY = srcMinY + (int)srcRec.height - 1;
+
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, src.format);
+    int bytesPerPixelDst = GetPixelDataSize(1, 1, dst->format);
+    int count = xMax - xMin + 1;
+
+    // Fast path: RGBA 32bit pixels are read and written directly, no format conversion required
+    bool srcIsColor = (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    bool dstIsColor = (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    for (int y = yMin; y <= yMax; y++)
+    {
+        // Source coordinates for first pixel center of the row
+        float dx = (xMin + 0.5f) - dstRec.x;
+        float dy = (y + 0.5f) - dstRec.y;
+        float u = srcRec.x + (cosRot*dx + sinRot*dy + origin.x)*scaleX;
+        float v = srcRec.y + (-sinRot*dx + cosRot*dy + origin.y)*scaleY;
+
+        // Get row pixels range mapped inside source rectangle: [spanStart, spanEnd)
+        float spanStart = 0.0f;
+        float spanEnd = (float)count;
+        const float coord[2] = { u, v };
+        const float step[2] = { uStepX, vStepX };
+        const float lower[2] = { srcRec.x, srcRec.y };
+        const float upper[2] = { srcRec.x + srcRec.width, srcRec.y + srcRec.height };
+
+        for (int i = 0; i < 2; i++)
+        {
+            if (fabsf(step[i]) < 1e-6f)
+            {
+                if ((coord[i] < lower[i]) || (coord[i] >= upper[i])) spanEnd = 0.0f;
+            }
+            else
+            {
+                float t0 = (lower[i] - coord[i])/step[i];
+                float t1 = (upper[i] - coord[i])/step[i];
+                if (t0 > t1) { float t = t0; t0 = t1; t1 = t; }
+                if (t0 > spanStart) spanStart = t0;
+                if (t1 < spanEnd) spanEnd = t1;
+            }
+        }
+
+        int start = (int)ceilf(spanStart);
+        int end = (int)ceilf(spanEnd);
+        if (end > count) end = count;
+        if (start >= end) continue;
+
+        // Source coordinates are stepped along the row in 16.16 fixed point
+        long long uFixed = (long long)((u + start*uStepX)*65536.0f);
+        long long vFixed = (long long)((v + start*vStepX)*65536.0f);
+        long long uFixedStep = (long long)(uStepX*65536.0f);
+        long long vFixedStep = (long long)(vStepX*65536.0f);
+
+        unsigned char *pDst = (unsigned char *)dst->data + ((size_t)y*dst->width + xMin + start)*bytesPerPixelDst;
+        Color colSrc = { 0 };
+
+        for (int x = start; x < end; x++, uFixed += uFixedStep, vFixed += vFixedStep, pDst += bytesPerPixelDst)
+        {
+            if (filter == TEXTURE_FILTER_POINT)
+            {
+                int sx = (int)(uFixed >> 16);
+                int sy = (int)(vFixed >> 16);
+                if (sx < srcMinX) sx = srcMinX;
+                else if (sx > srcMaxX) sx = srcMaxX;
+                if (sy < srcMinY) sy = srcMinY;
+                else if (sy > srcMaxY) sy = srcMaxY;
+
+                if (srcIsColor) colSrc = ((const Color *)src.data)[(size_t)sy*src.width + sx];
+                else colSrc = GetPixelColor((unsigned char *)src.data + ((size_t)sy*src.width + sx)*bytesPerPixelSrc, src.format);
+            }
+            else
+            {
+                // Bilinear filtering between the four nearest pixel centers, weights in 8bit fixed point
+                long long uCenter = uFixed - 32768;
+                long long vCenter = vFixed - 32768;
+                int sx0 = (int)(uCenter >> 16);
+                int sy0 = (int)(vCenter >> 16);
+                int wx = (int)((uCenter >> 8) & 0xff);
+                int wy = (int)((vCenter >> 8) & 0xff);
+                int sx1 = sx0 + 1;
+                int sy1 = sy0 + 1;
+
+                if (sx0 < srcMinX) sx0 = srcMinX;
+                if (sx1 > srcMaxX) sx1 = srcMaxX;
+                if (sx0 > srcMaxX) sx0 = srcMaxX;
+                if (sx1 < srcMinX) sx1 = srcMinX;
+                if (sy0 < srcMinY) sy0 = srcMinY;
+                if (sy1 > srcMaxY) sy1 = srcMaxY;
+                if (sy0 > srcMaxY) sy0 = srcMaxY;
+                if (sy1 < srcMinY) sy1 = srcMinY;
+
+                const unsigned char *row0 = (const unsigned char *)src.data + (size_t)sy0*src.width*bytesPerPixelSrc;
+                const unsigned char *row1 = (const unsigned char *)src.data + (size_t)sy1*src.width*bytesPerPixelSrc;
+                Color c00 = { 0 };
+                Color c10 = { 0 };
+                Color c01 = { 0 };
+                Color c11 = { 0 };
+
+                if (srcIsColor)
+                {
+                    c00 = ((const Color *)row0)[sx0];
+                    c10 = ((const Color *)row0)[sx1];
+                    c01 = ((const Color *)row1)[sx0];
+                    c11 = ((const Color *)row1)[sx1];
+                }
+                else
+                {
+                    c00 = GetPixelColor((void *)(row0 + sx0*bytesPerPixelSrc), src.format);
+                    c10 = GetPixelColor((void *)(row0 + sx1*bytesPerPixelSrc), src.format);
+                    c01 = GetPixelColor((void *)(row1 + sx0*bytesPerPixelSrc), src.format);
+                    c11 = GetPixelColor((void *)(row1 + sx1*bytesPerPixelSrc), src.format);
+                }
+
+                int w00 = (256 - wx)*(256 - wy);
+                int w10 = wx*(256 - wy);
+                int w01 = (256 - wx)*wy;
+                int w11 = wx*wy;
+
+                colSrc.r = (unsigned char)((c00.r*w00 + c10.r*w10 + c01.r*w01 + c11.r*w11 + 32768) >> 16);
+                colSrc.g = (unsigned char)((c00.g*w00 + c10.g*w10 + c01.g*w01 + c11.g*w11 + 32768) >> 16);
+                colSrc.b = (unsigned char)((c00.b*w00 + c10.b*w10 + c01.b*w01 + c11.b*w11 + 32768) >> 16);
+                colSrc.a = (unsigned char)((c00.a*w00 + c10.a*w10 + c01.a*w01 + c11.a*w11 + 32768) >> 16);
+            }
+
+            if (dstIsColor)
+            {
+                if (blendRequired) *(Color *)pDst = ColorAlphaBlend(*(Color *)pDst, colSrc, tint);
+                else *(Color *)pDst = colSrc;
+            }
+            else if (blendRequired) SetPixelColor(pDst, ColorAlphaBlend(GetPixelColor(pDst, dst->format), colSrc, tint), dst->format);
+            else SetPixelColor(pDst, colSrc, dst->format);
+        }
+    }
+}
+
 #endif // SUPPORT_MODULE_RTEXTURES
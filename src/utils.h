@@ -0,0 +1,149 @@
+/**********************************************************************************************
+*
+*   utils - Internal utilities shared by raylib modules
+*
+*   FEATURES:
+*       - Worker threads tasks runner: RunParallelTasks() [Used by rmodels and rtext modules]
+*
+*   CONFIGURATION:
+*       #define SUPPORT_WORKER_THREADS
+*           Tasks are split across worker threads, if disabled (or threads can not be created)
+*           all tasks are run on calling thread
+*
+*   NOTE: Functions are declared static (internal linkage), every including module gets its own copy,
+*   no symbols are exported by the library and no dependency between modules is created
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2013-2026 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef UTILS_H
+#define UTILS_H
+
+#include <stdint.h>         // Required for: uintptr_t
+
+#if SUPPORT_WORKER_THREADS
+#if defined(_WIN32)
+    #include <process.h>    // Required for: _beginthreadex() [Used in RunParallelTasks()]
+
+    // Declare required Win32 functions to avoid including windows.h (names conflict with raylib)
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+    __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+#else
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join() [Used in RunParallelTasks()]
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS      4       // Maximum threads used to run parallel tasks (calling thread included)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if SUPPORT_WORKER_THREADS
+// Parallel task, processing function and data
+typedef struct ParallelTask {
+    void (*process)(void *data); // Task processing function
+    void *data;                 // Task data
+} ParallelTask;
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void RunParallelTasks(void (*process)(void *data), void *tasks, int taskCount, int taskSize); // Run tasks on worker threads
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+#if SUPPORT_WORKER_THREADS
+// Parallel task thread entry point
+#if defined(_WIN32)
+static unsigned int __stdcall ParallelTaskThread(void *arg)
+{
+    ParallelTask *task = (ParallelTask *)arg;
+    task->process(task->data);
+    return 0;
+}
+#else
+static void *ParallelTaskThread(void *arg)
+{
+    ParallelTask *task = (ParallelTask *)arg;
+    task->process(task->data);
+    return NULL;
+}
+#endif
+#endif
+
+// Run tasks on worker threads, first task is run on calling thread
+// NOTE: Tasks data is an array of taskSize bytes elements, in case a worker thread
+// can not be created (i.e. no threads support on platform) task is run on calling thread,
+// tasks exceeding MAX_WORKER_THREADS are also run on calling thread
+static void RunParallelTasks(void (*process)(void *data), void *tasks, int taskCount, int taskSize)
+{
+#if SUPPORT_WORKER_THREADS
+    ParallelTask parallelTasks[MAX_WORKER_THREADS] = { 0 };
+    bool threadStarted[MAX_WORKER_THREADS] = { 0 };
+#if defined(_WIN32)
+    uintptr_t threads[MAX_WORKER_THREADS] = { 0 };
+#else
+    pthread_t threads[MAX_WORKER_THREADS] = { 0 };
+#endif
+
+    int threadCount = (taskCount > MAX_WORKER_THREADS)? MAX_WORKER_THREADS : taskCount;
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        parallelTasks[i].process = process;
+        parallelTasks[i].data = (unsigned char *)tasks + i*taskSize;
+#if defined(_WIN32)
+        threads[i] = _beginthreadex(NULL, 0, ParallelTaskThread, &parallelTasks[i], 0, NULL);
+        threadStarted[i] = (threads[i] != 0);
+#else
+        threadStarted[i] = (pthread_create(&threads[i], NULL, ParallelTaskThread, &parallelTasks[i]) == 0);
+#endif
+    }
+
+    if (taskCount > 0) process(tasks);
+
+    for (int i = 1; i < taskCount; i++)
+    {
+        if ((i < threadCount) && threadStarted[i])
+        {
+#if defined(_WIN32)
+            WaitForSingleObject((void *)threads[i], 0xFFFFFFFF);    // INFINITE
+            CloseHandle((void *)threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else process((unsigned char *)tasks + i*taskSize);
+    }
+#else
+    for (int i = 0; i < taskCount; i++) process((unsigned char *)tasks + i*taskSize);
+#endif
+}
+
+#endif // UTILS_H